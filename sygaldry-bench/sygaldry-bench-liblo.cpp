@@ -0,0 +1,44 @@
+/*
+Copyright 2026 Travis J. West, https://traviswest.ca, Input Devices and Music
+Interaction Laboratory (IDMIL), Centre for Interdisciplinary Research in Music
+Media and Technology (CIRMMT), McGill University, Montréal, Canada, and Univ.
+Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
+
+SPDX-License-Identifier: LGPL-2.1-or-later
+*/
+
+#include <string>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "sygah-metadata.hpp"
+#include "sygah-endpoints.hpp"
+#include "sygac-components.hpp"
+#include "sygbp-liblo.hpp"
+#include "sygaldry-bench.hpp"
+
+using namespace sygaldry;
+
+struct liblo_components_t
+{
+    assembly_8_t assembly;
+};
+
+TEST_CASE("sygaldry bench LibloOsc", "[bindings][liblo]")
+{
+    static liblo_components_t components{};
+    sygbp::LibloOsc<liblo_components_t> osc{};
+    osc.inputs.dst_addr = std::string("127.0.0.1");
+    osc.inputs.dst_port = std::string("9999");
+    osc.set_dst();
+    REQUIRE(osc.outputs.output_running);
+    BENCHMARK("LibloOsc::external_destinations, no updated outputs")
+    {
+        clear_output_flags(components);
+        osc.external_destinations(components);
+    };
+    BENCHMARK("LibloOsc::external_destinations, 8 updated outputs")
+    {
+        for_each_component(components, [](synthetic_t& c) { c.outputs.out = 0.5f; });
+        osc.external_destinations(components);
+    };
+}
@@ -0,0 +1,67 @@
+/*
+Copyright 2026 Travis J. West, https://traviswest.ca, Input Devices and Music
+Interaction Laboratory (IDMIL), Centre for Interdisciplinary Research in Music
+Media and Technology (CIRMMT), McGill University, Montréal, Canada, and Univ.
+Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
+
+SPDX-License-Identifier: MIT
+*/
+
+#include <string>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <rapidjson/stream.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+#include "sygah-metadata.hpp"
+#include "sygah-endpoints.hpp"
+#include "sygbp-rapid_json.hpp"
+
+using namespace sygaldry;
+
+struct session_component_t : name_<"Session">
+{
+    struct inputs_t {
+        text_message<"text", "session text", tag_session_data> text;
+        slider<"slider", "session slider", float, 0.0f, 1.0f, 0.0f, tag_session_data> slider;
+        array<"array", 3, "session array", float, 0.0f, 1.0f, 0.0f, tag_session_data> array;
+    } inputs;
+
+    void main() {}
+};
+
+struct session_components_t
+{
+    session_component_t session;
+};
+
+struct bench_ostream
+{
+    inline static rapidjson::StringBuffer obuffer{};
+    rapidjson::Writer<rapidjson::StringBuffer> writer;
+    bench_ostream() : writer{obuffer} {}
+};
+
+TEST_CASE("sygaldry bench RapidJsonSessionStorage", "[bindings][rapid_json]")
+{
+    static session_components_t components{};
+    std::string ibuffer{""};
+    rapidjson::StringStream istream{ibuffer.c_str()};
+    sygbp::RapidJsonSessionStorage<rapidjson::StringStream, bench_ostream, session_components_t> storage{};
+    storage.init(istream, components);
+    storage.external_destinations(components);
+    BENCHMARK("RapidJsonSessionStorage::external_destinations, unchanged")
+    {
+        storage.external_destinations(components);
+        return bench_ostream::obuffer.GetSize();
+    };
+    float value = 0.0f;
+    BENCHMARK("RapidJsonSessionStorage::external_destinations, changed")
+    {
+        value = value < 1.0f ? value + 0.001f : 0.0f;
+        components.session.inputs.slider = value;
+        bench_ostream::obuffer.Clear();
+        storage.external_destinations(components);
+        return bench_ostream::obuffer.GetSize();
+    };
+}
@@ -0,0 +1,199 @@
+/*
+Copyright 2026 Travis J. West, https://traviswest.ca, Input Devices and Music
+Interaction Laboratory (IDMIL), Centre for Interdisciplinary Research in Music
+Media and Technology (CIRMMT), McGill University, Montréal, Canada, and Univ.
+Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
+
+SPDX-License-Identifier: MIT
+*/
+
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "sygah-metadata.hpp"
+#include "sygah-endpoints.hpp"
+#include "sygac-components.hpp"
+#include "sygac-runtime.hpp"
+#include "sygbp-osc_match_pattern.hpp"
+#include "sygup-basic_logger.hpp"
+#include "sygsp-complementary_mimu_fusion.hpp"
+#include "sygaldry-bench.hpp"
+
+using namespace sygaldry;
+
+assembly_1_t assembly_1{};
+assembly_8_t assembly_8{};
+assembly_64_t assembly_64{};
+constexpr auto runtime_1 = Runtime{assembly_1};
+constexpr auto runtime_8 = Runtime{assembly_8};
+constexpr auto runtime_64 = Runtime{assembly_64};
+
+TEST_CASE("sygaldry bench Runtime tick", "[runtime]")
+{
+    runtime_1.init();
+    runtime_8.init();
+    runtime_64.init();
+    BENCHMARK("tick, 1 component")
+    {
+        assembly_1.c0.inputs.in = 0.5f;
+        runtime_1.tick();
+        return assembly_1.c0.outputs.count.value;
+    };
+    BENCHMARK("tick, 8 components")
+    {
+        assembly_8.c0.inputs.in = 0.5f;
+        runtime_8.tick();
+        return assembly_8.c7.outputs.count.value;
+    };
+    BENCHMARK("tick, 64 components")
+    {
+        assembly_64.a0.c0.inputs.in = 0.5f;
+        runtime_64.tick();
+        return assembly_64.a7.c7.outputs.count.value;
+    };
+}
+
+TEST_CASE("sygaldry bench for_each_endpoint", "[reflection]")
+{
+    BENCHMARK("for_each_endpoint, 8 components")
+    {
+        int n = 0;
+        for_each_endpoint(assembly_8, [&](auto&) { ++n; });
+        return n;
+    };
+    BENCHMARK("for_each_endpoint, 64 components")
+    {
+        int n = 0;
+        for_each_endpoint(assembly_64, [&](auto&) { ++n; });
+        return n;
+    };
+    BENCHMARK("clear flags, 64 components")
+    {
+        assembly_64.a0.c0.inputs.in = 0.5f;
+        clear_flags(assembly_64);
+        return flag_state_of(assembly_64.a0.c0.inputs.in);
+    };
+}
+template<typename Key>
+struct keys_t : name_<"keys">
+{
+    struct inputs_t {
+        Key k00, k01, k02, k03, k04, k05, k06, k07, k08, k09, k10, k11, k12, k13, k14, k15, k16, k17, k18, k19, k20, k21, k22, k23, k24, k25, k26, k27, k28, k29, k30, k31;
+    } inputs;
+};
+
+using unpacked_keys_t = keys_t<slider_message<"key">>;
+using packed_keys_t = keys_t<slider_message<"key", "", float, 0.0f, 1.0f, 0.0f, tag_packed_flag>>;
+static_assert(sizeof(unpacked_keys_t) == sizeof(packed_keys_t));
+
+TEST_CASE("sygaldry bench packed flags", "[reflection][packed_flags]")
+{
+    static unpacked_keys_t unpacked{};
+    static packed_keys_t packed{};
+    static packed_flags<packed_keys_t> flags{};
+    flags.bind(packed);
+    REQUIRE(flags.inputs.entry != 0);
+    BENCHMARK("clear 32 input flags")
+    {
+        unpacked.inputs.k00 = 0.5f;
+        clear_input_flags(unpacked);
+        return flag_state_of(unpacked.inputs.k00);
+    };
+    BENCHMARK("clear 32 packed input flags")
+    {
+        packed.inputs.k00 = 0.5f;
+        clear_input_flags(packed, flags);
+        return flag_state_of(packed.inputs.k00);
+    };
+}
+
+TEST_CASE("sygaldry bench osc_match_pattern", "[osc]")
+{
+    BENCHMARK("osc_match_pattern, literal match")
+    {
+        return osc_match_pattern("/Trill_Craft/speed", "/Trill_Craft/speed");
+    };
+    BENCHMARK("osc_match_pattern, literal mismatch")
+    {
+        return osc_match_pattern("/Trill_Craft/speed", "/Trill_Craft/prescaler");
+    };
+    BENCHMARK("osc_match_pattern, wildcards")
+    {
+        return osc_match_pattern("/*/[a-z]?ee{d,ds}", "/Trill_Craft/speed");
+    };
+    BENCHMARK("osc_match_pattern, 64 addresses")
+    {
+        static const char * addresses[] =
+        { "/Button/input state", "/Button/debounced state", "/Button/any", "/Button/duration"
+        , "/Trill_Craft/speed", "/Trill_Craft/resolution", "/Trill_Craft/prescaler", "/Trill_Craft/map"
+        };
+        int n = 0;
+        for (int i = 0; i < 8; ++i)
+            for (auto address : addresses) n += osc_match_pattern("/Trill_Craft/*", address);
+        return n;
+    };
+    BENCHMARK("osc_match_pattern, 64 addresses, compiled once")
+    {
+        static const char * addresses[] =
+        { "/Button/input state", "/Button/debounced state", "/Button/any", "/Button/duration"
+        , "/Trill_Craft/speed", "/Trill_Craft/resolution", "/Trill_Craft/prescaler", "/Trill_Craft/map"
+        };
+        osc_compiled_pattern pattern;
+        osc_compile_pattern("/Trill_Craft/*", pattern);
+        int n = 0;
+        for (int i = 0; i < 8; ++i)
+            for (auto address : addresses) n += osc_match_pattern(pattern, address);
+        return n;
+    };
+    BENCHMARK("osc_match_pattern, pathological glob")
+    {
+        return osc_match_pattern("/*a*a*a*a*a*a*a*a*b", "/aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa");
+    };
+}
+
+struct bench_putter
+{
+    static inline std::array<char, 256> buffer{};
+    static inline std::size_t n = 0;
+    void operator()(char c) { buffer[n++ % buffer.size()] = c; }
+};
+
+TEST_CASE("sygaldry bench BasicLogger", "[logger]")
+{
+    sygup::BasicLogger<bench_putter> log{};
+    BENCHMARK("BasicLogger, int")
+    {
+        log.println(-123456);
+        return bench_putter::n;
+    };
+    BENCHMARK("BasicLogger, float")
+    {
+        log.println(3.14159f);
+        return bench_putter::n;
+    };
+    BENCHMARK("BasicLogger, endpoint line")
+    {
+        log.println("/Complementary_MIMU_Fusion/quaternion ", std::array<float, 4>{0.5f, 0.5f, -0.5f, 0.5f});
+        return bench_putter::n;
+    };
+}
+
+TEST_CASE("sygaldry bench complementary_mimu_fusion", "[fusion]")
+{
+    sygsp::ComplementaryMimuFusionInputs in{};
+    sygsp::ComplementaryMimuFusionOutputs out{};
+    sygsp::complementary_mimu_fusion_init(in, out);
+    const std::array<float, 3> gyro{0.01f, -0.02f, 0.03f};
+    const std::array<float, 3> accl{0.0f, 0.1f, 0.99f};
+    const std::array<float, 3> magn{0.3f, 0.1f, -0.4f};
+    BENCHMARK("complementary_mimu_fusion, all measurements")
+    {
+        sygsp::complementary_mimu_fusion(gyro, accl, true, magn, true, 1000, in, out);
+        return out.quaternion.state;
+    };
+    BENCHMARK("complementary_mimu_fusion, gyroscope only")
+    {
+        sygsp::complementary_mimu_fusion(gyro, accl, false, magn, false, 1000, in, out);
+        return out.quaternion.state;
+    };
+}
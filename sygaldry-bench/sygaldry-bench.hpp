@@ -0,0 +1,58 @@
+#pragma once
+/*
+Copyright 2026 Travis J. West, https://traviswest.ca, Input Devices and Music
+Interaction Laboratory (IDMIL), Centre for Interdisciplinary Research in Music
+Media and Technology (CIRMMT), McGill University, Montréal, Canada, and Univ.
+Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
+
+SPDX-License-Identifier: MIT
+*/
+
+#include "sygah-metadata.hpp"
+#include "sygah-endpoints.hpp"
+#include "sygac-endpoints.hpp"
+
+namespace sygaldry {
+
+struct synthetic_t : name_<"synthetic">
+{
+    struct inputs_t {
+        slider_message<"in", "occasional input"> in;
+        slider<"gain", "persistent input", float, 0.0f, 2.0f, 1.0f> gain;
+        bng<"reset", "event input"> reset;
+    } inputs;
+
+    struct outputs_t {
+        slider_message<"out", "occasional output", float, 0.0f, 2.0f> out;
+        array<"history", 4, "persistent output"> history;
+        slider<"count", "ticks since the last reset", int, 0, 1000000> count;
+    } outputs;
+
+    void main()
+    {
+        if (inputs.reset) outputs.count = 0;
+        else outputs.count = outputs.count + 1;
+        if (flag_state_of(inputs.in))
+        {
+            outputs.out = inputs.in * inputs.gain;
+            outputs.history[outputs.count % 4] = outputs.out;
+        }
+    }
+};
+
+struct assembly_1_t
+{
+    synthetic_t c0;
+};
+
+struct assembly_8_t
+{
+    synthetic_t c0, c1, c2, c3, c4, c5, c6, c7;
+};
+
+struct assembly_64_t
+{
+    assembly_8_t a0, a1, a2, a3, a4, a5, a6, a7;
+};
+
+}
@@ -8,6 +8,11 @@ Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
 SPDX-License-Identifier: MIT
 */
 
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <type_traits>
 #include <utility>
 #include <boost/pfr.hpp>
 #include <boost/mp11.hpp>
@@ -44,25 +49,43 @@ concept SimpleAggregate
        )
     ;
 
+/*! \brief Check if T can be returned by an init or main subroutine that continues in later ticks
+
+\details A subroutine may return a resumable result, such as a `sygaldry::task`
+returned by a coroutine, to indicate that it has suspended before finishing.
+The runtime keeps the result and calls `resume()` in later ticks until `done()`
+returns true. A default constructed result must be `done()`.
+*/
+template<typename T>
+concept Resumable = std::default_initializable<T> && std::movable<T> && requires (T& t)
+{
+    {t.done()} -> std::convertible_to<bool>;
+    t.resume();
+};
+
+/// Check if T is an acceptable return type for an init or main subroutine, i.e. `void` or \ref Resumable
+template<typename T>
+concept subroutine_result = std::same_as<void, T> || Resumable<T>;
+
 /// Default case for main subroutine reflection where the main subroutine does not exist.
 template <typename T> struct main_subroutine_reflection {using exists = std::false_type;};
 
 /// Main subroutine reflection for function call operator; this takes precedence over a method called "main"
 template <typename T>
-    requires (std::same_as<void, typename function_reflection<&T::operator()>::return_type>
-          && !std::same_as<void, typename function_reflection<&T::main>::return_type>)
+    requires (subroutine_result<typename function_reflection<&T::operator()>::return_type>
+          && !subroutine_result<typename function_reflection<&T::main>::return_type>)
 struct main_subroutine_reflection<T> : function_reflection<&T::operator()> {};
 
 /// Main subroutine reflection for a method called "main"
 template <typename T>
-    requires std::same_as<void, typename function_reflection<&T::main>::return_type>
+    requires subroutine_result<typename function_reflection<&T::main>::return_type>
 struct main_subroutine_reflection<T> : function_reflection<&T::main> {};
 /// Default case for init subroutine reflection where the init subroutine does not exist.
 template <typename T> struct init_subroutine_reflection {using exists = std::false_type;};
 
 /// Init subroutine reflection for a method called "init"
 template <typename T>
-    requires std::same_as<void, typename function_reflection<&T::init>::return_type>
+    requires subroutine_result<typename function_reflection<&T::init>::return_type>
 struct init_subroutine_reflection<T> : function_reflection<&T::init> {};
 
 /// Default case for external sources subroutine reflection where the subroutine does not exist.
@@ -82,12 +105,12 @@ template <typename T>
 struct external_destinations_subroutine_reflection<T> : function_reflection<&T::external_destinations> {};
 template<typename T>
 concept has_main_subroutine // = main_subroutine_reflection<T>::exists::value;
-    =  std::same_as<void, typename function_reflection<&T::operator()>::return_type>
-    || std::same_as<void, typename function_reflection<&T::main>::return_type>
+    =  subroutine_result<typename function_reflection<&T::operator()>::return_type>
+    || subroutine_result<typename function_reflection<&T::main>::return_type>
     ;
 template<typename T>
 concept has_init_subroutine
-    = std::same_as<void, typename function_reflection<&T::init>::return_type>;
+    = subroutine_result<typename function_reflection<&T::init>::return_type>;
 template<typename T>
 concept has_external_sources_subroutine
     = std::same_as<void, typename function_reflection<&T::external_sources>::return_type>;
@@ -246,6 +269,124 @@ constexpr auto component_to_tree(T& component)
         return tpl::tuple_cat( head, tail);
     }
 }
+/// Step from a simple aggregate node to its `I`th field
+template<std::size_t I>
+struct field_step
+{
+    static constexpr auto& get(auto& parent) { return boost::pfr::get<I>(parent); }
+};
+
+/// Step from a component to its inputs container
+struct inputs_step
+{
+    static constexpr auto& get(auto& component) { return inputs_of(component); }
+};
+
+/// Step from a component to its outputs container
+struct outputs_step
+{
+    static constexpr auto& get(auto& component) { return outputs_of(component); }
+};
+template<typename Node> struct indexed_lineage { using type = typename Node::lineage; };
+template<> struct indexed_lineage<void> { using type = boost::mp11::mp_list<>; };
+
+/// An entry in the node index of a component tree; `Parent` is the entry of the parent node, or `void` for the root
+template<typename Tag, typename T, typename Parent = void, typename Step = void>
+struct indexed_node
+{
+    using tag = Tag;
+    using type = T;
+    using parent = Parent;
+    /// The entries of the named ancestors of the node, and of the node itself if it is named
+    using lineage = boost::mp11::mp_if_c< has_name<T>
+                                        , boost::mp11::mp_push_back<typename indexed_lineage<Parent>::type, indexed_node>
+                                        , typename indexed_lineage<Parent>::type
+                                        >;
+    /// The entries of the named ancestors of the node, followed by the entry of the node
+    using path = boost::mp11::mp_push_back<typename indexed_lineage<Parent>::type, indexed_node>;
+
+    /// Get a reference to the node from a reference to the root of its tree
+    static constexpr auto& get(auto& root)
+    {
+        if constexpr (std::is_void_v<Parent>) return root;
+        else return Step::get(Parent::get(root));
+    }
+};
+
+/// The type of the child reached from the node of entry `Parent` by `Step`
+template<typename Parent, typename Step>
+using indexed_child_t = std::remove_reference_t<decltype(Step::get(std::declval<typename Parent::type&>()))>;
+/// The index of the endpoint container of the component with entry `Component` and its endpoints, if any
+template<typename Tag, typename Component>
+struct endpoints_index { using type = boost::mp11::mp_list<>; };
+
+template<typename Tag, typename Component>
+    requires (  std::same_as<Tag, node::input_endpoint> && has_inputs<typename Component::type>
+             || std::same_as<Tag, node::output_endpoint> && has_outputs<typename Component::type>
+             )
+struct endpoints_index<Tag, Component>
+{
+    using container_tag = boost::mp11::mp_if_c< std::same_as<Tag, node::input_endpoint>
+                                              , node::inputs_container
+                                              , node::outputs_container
+                                              >;
+    using step = boost::mp11::mp_if_c<std::same_as<Tag, node::input_endpoint>, inputs_step, outputs_step>;
+    using container = indexed_node<container_tag, indexed_child_t<Component, step>, Component, step>;
+    template<typename I> using endpoint = indexed_node<Tag, indexed_child_t<container, field_step<I::value>>, container, field_step<I::value>>;
+    using size = boost::mp11::mp_size_t<boost::pfr::tuple_size_v<std::remove_cv_t<typename container::type>>>;
+    using type = boost::mp11::mp_push_front<boost::mp11::mp_transform<endpoint, boost::mp11::mp_iota<size>>, container>;
+};
+
+/// The flat index of the component tree rooted at `T`, which is reached from the entry `Parent` by `Step`
+template<typename T, typename Parent = void, typename Step = void>
+struct node_index
+{
+    using self = indexed_node<node::assembly, T, Parent, Step>;
+    template<typename I> using subtree = typename node_index<indexed_child_t<self, field_step<I::value>>, self, field_step<I::value>>::type;
+    using size = boost::mp11::mp_size_t<boost::pfr::tuple_size_v<std::remove_cv_t<T>>>;
+    using type = boost::mp11::mp_apply< boost::mp11::mp_append
+                                      , boost::mp11::mp_push_front< boost::mp11::mp_transform<subtree, boost::mp11::mp_iota<size>>
+                                                                  , boost::mp11::mp_list<self>
+                                                                  >
+                                      >;
+};
+
+template<typename T, typename Parent, typename Step>
+    requires Component<std::remove_cv_t<T>>
+struct node_index<T, Parent, Step>
+{
+    using self = indexed_node<node::component, T, Parent, Step>;
+    using type = boost::mp11::mp_append< boost::mp11::mp_list<self>
+                                       , typename endpoints_index<node::input_endpoint, self>::type
+                                       , typename endpoints_index<node::output_endpoint, self>::type
+                                       >;
+};
+
+/// The flat index of the component tree of `T`
+template<typename T> using node_index_t = typename node_index<T>::type;
+
+template<typename Y>
+struct indexed_type_is
+{
+    template<typename Node> using fn = std::is_same<Y, typename Node::type>;
+};
+
+/// The entry of the first node of type `Y` in the index of the component tree of `T`, or `void` if there is none
+template<typename Y, typename T>
+using indexed_node_t = boost::mp11::mp_eval_if_c
+        < boost::mp11::mp_find_if_q<node_index_t<T>, indexed_type_is<Y>>::value == boost::mp11::mp_size<node_index_t<T>>::value
+        , void
+        , boost::mp11::mp_at
+        , node_index_t<T>
+        , boost::mp11::mp_find_if_q<node_index_t<T>, indexed_type_is<Y>>
+        >;
+template<typename T, typename ... Nodes>
+constexpr auto indexed_nodes_to_node_list(T& root, boost::mp11::mp_list<Nodes...>)
+{
+    return tpl::tuple<tagged<typename Nodes::tag, typename Nodes::type>...>{
+        tagged<typename Nodes::tag, typename Nodes::type>{Nodes::get(root)}...
+    };
+}
 template<Tuple T>
 constexpr auto component_tree_to_node_list(T tree)
 {
@@ -258,7 +399,7 @@ constexpr auto component_tree_to_node_list(T tree)
 template<typename T>
 constexpr auto component_to_node_list(T& component)
 {
-    return component_tree_to_node_list(component_to_tree(component));
+    return indexed_nodes_to_node_list(component, node_index_t<T>{});
 }
 template<template<typename>typename F>
 constexpr auto node_list_filter(Tuple auto tup)
@@ -278,10 +419,21 @@ constexpr auto node_list_filter(Tuple auto tup)
         else return tpl::tuple<>{};
     }));
 }
+template<template<typename>typename F>
+struct indexed_node_predicate
+{
+    template<typename Node> using fn = F<tagged<typename Node::tag, typename Node::type>>;
+};
+
 template<template<typename>typename F, typename T>
 constexpr auto component_filter(T& component)
 {
-    return node_list_filter<F>(component_to_node_list(component));
+    using nodes = boost::mp11::mp_copy_if_q<node_index_t<T>, indexed_node_predicate<F>>;
+    if constexpr (boost::mp11::mp_size<nodes>::value == 0)
+        return;
+    else if constexpr (boost::mp11::mp_size<nodes>::value == 1)
+        return tpl::get<0>(indexed_nodes_to_node_list(component, nodes{}));
+    else return indexed_nodes_to_node_list(component, nodes{});
 }
 template<typename T>
 struct tagged_is_same
@@ -299,7 +451,9 @@ constexpr auto& find(Tuple auto tup)
 template<typename T>
 constexpr auto& find(auto& component)
 {
-    return node_list_filter<tagged_is_same<T>::template fn>(component_to_node_list(component)).ref;
+    using node = indexed_node_t<T, std::remove_reference_t<decltype(component)>>;
+    static_assert(not std::is_void_v<node>, "find: no node of the requested type");
+    return node::get(component);
 }
 template<typename ... RequestedNodes>
 struct _search_by_tags
@@ -316,7 +470,7 @@ constexpr auto node_list_filter_by_tag(Tuple auto tup)
 template<typename ... RequestedNodes>
 constexpr auto component_filter_by_tag(auto& component)
 {
-    return node_list_filter<_search_by_tags<RequestedNodes...>::template fn>(component_to_node_list(component));
+    return component_filter<_search_by_tags<RequestedNodes...>::template fn>(component);
 }
 
 template<typename ... RequestedNodes>
@@ -360,7 +514,9 @@ template<typename T, typename C>
     requires Component<C> || Assembly<C>
 constexpr auto path_of(C& component)
 {
-    return path_of<T>(component_to_tree(component));
+    using node = indexed_node_t<T, C>;
+    if constexpr (std::is_void_v<node>) return tpl::tuple<>{};
+    else return indexed_nodes_to_node_list(component, typename node::path{});
 }
 template<typename Tag> using untagged = typename Tag::type;
 
@@ -482,6 +638,89 @@ void clear_input_flags(auto& component)
     for_each_input(component, [](auto& endpoint) { clear_flag(endpoint); });
 }
 
+/// A bitset holding `N` packed flags; see `flag_bit` in \ref page-sygah-endpoints
+template<std::size_t N>
+struct flag_bitset
+{
+    static_assert(N <= 256, "the index of a packed flag in its bitset must fit in a byte");
+    using word_t = std::uint32_t;
+    static constexpr std::size_t bits = 8 * sizeof(word_t);
+    std::array<word_t, (N + bits - 1) / bits> words{};
+    /// The entry of the bitset in the flags' table of bound bitsets, or 0 if the flags aren't bound to it
+    unsigned char entry = 0;
+
+    constexpr void clear() noexcept { for (auto& w : words) w = 0; }
+    constexpr bool test(std::size_t i) const noexcept { return words[i / bits] & (word_t{1} << (i % bits)); }
+    constexpr bool any() const noexcept { for (auto w : words) if (w) return true; return false; }
+    constexpr std::size_t count() const noexcept { std::size_t n = 0; for (auto w : words) n += std::popcount(w); return n; }
+    /// Store the packed flag `flag` in bit `i` from now on, unless the table of bound bitsets is full
+    void bind(std::size_t i, auto& flag) noexcept
+    {
+        if (entry == 0) entry = std::remove_cvref_t<decltype(flag)>::bitset_entry(words.data());
+        flag.bind(entry, static_cast<unsigned char>(i));
+    }
+};
+
+template<typename Endpoint> using is_packed_flag = std::bool_constant<PackedUpdatedFlag<std::remove_cvref_t<Endpoint>>>;
+
+/// The number of endpoints with packed flags among the nodes of component `T` tagged with `Tag`
+template<typename T, typename Tag>
+constexpr std::size_t packed_flag_count = []()
+{
+    using nodes = decltype(component_filter_by_tag<Tag>(std::declval<T&>()));
+    if constexpr (std::is_void_v<nodes>) return std::size_t{0};
+    else if constexpr (Tuple<nodes>)
+        return std::size_t{boost::mp11::mp_count_if<boost::mp11::mp_transform<untagged, nodes>, is_packed_flag>::value};
+    else return std::size_t{is_packed_flag<untagged<nodes>>::value};
+}();
+
+/// Storage for the packed flags of the input and output endpoints of a component of type `T`
+template<typename T>
+struct packed_flags
+{
+    flag_bitset<packed_flag_count<T, node::input_endpoint>> inputs;
+    flag_bitset<packed_flag_count<T, node::output_endpoint>> outputs;
+
+    /// Store the packed flags of the endpoints of `component` in this storage from now on, keeping their state
+    void bind(T& component)
+    {
+        std::size_t i = 0;
+        for_each_input(component, [&]<typename Y>(Y& endpoint)
+        {
+            if constexpr (PackedUpdatedFlag<Y>) inputs.bind(i++, endpoint.updated);
+        });
+        i = 0;
+        for_each_output(component, [&]<typename Y>(Y& endpoint)
+        {
+            if constexpr (PackedUpdatedFlag<Y>) outputs.bind(i++, endpoint.updated);
+        });
+    }
+};
+
+/// Clear the output flags of `component`, whose packed flags are bound to `flags`
+template<typename T>
+void clear_output_flags(T& component, packed_flags<T>& flags)
+{
+    flags.outputs.clear();
+    for_each_output(component, [&]<typename Y>(Y& endpoint)
+    {
+        if constexpr (not PackedUpdatedFlag<Y>) clear_flag(endpoint);
+        else if (flags.outputs.entry == 0) clear_flag(endpoint);
+    });
+}
+
+/// Clear the input flags of `component`, whose packed flags are bound to `flags`
+template<typename T>
+void clear_input_flags(T& component, packed_flags<T>& flags)
+{
+    flags.inputs.clear();
+    for_each_input(component, [&]<typename Y>(Y& endpoint)
+    {
+        if constexpr (not PackedUpdatedFlag<Y>) clear_flag(endpoint);
+        else if (flags.inputs.entry == 0) clear_flag(endpoint);
+    });
+}
+
 template<Component T>
 void init(T& component)
 {
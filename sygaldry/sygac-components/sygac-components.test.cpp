@@ -98,6 +98,12 @@ struct int_operator { int operator()() {return 1;} };
 static_assert(not has_main_subroutine<member_main>);
 static_assert(not has_main_subroutine<int_main>);
 static_assert(not has_main_subroutine<int_operator>);
+
+struct resumable_t { bool done() const {return true;} void resume() {} };
+struct resumable_main { resumable_t main() {return {};} };
+struct resumable_init { resumable_t init() {return {};} };
+static_assert(has_main_subroutine<resumable_main>);
+static_assert(has_init_subroutine<resumable_init>);
 static_assert(std::same_as<regular_component_t::inputs_t&, decltype(inputs_of(regular_component))>);
 static_assert(std::same_as<regular_component_t::outputs_t&, decltype(outputs_of(regular_component))>);
 
@@ -227,6 +233,18 @@ TEST_CASE("sygaldry tuple head and tail")
     auto empty_tuple = tpl::tuple<>{};
     auto empty = tuple_head(empty_tuple);
 }
+static_assert(std::same_as< boost::mp11::mp_transform<untagged, node_index_t<accessor_test_container_t>>
+                          , boost::mp11::mp_list<atc, c1, ic1, in11, in21, oc1, out1, c2, ic2, in12, in22, oc2, out2>
+                          >);
+static_assert(std::same_as<indexed_node_t<in21, accessor_test_container_t>::parent::type, ic1>);
+static_assert(std::same_as<indexed_node_t<c2, accessor_test_container_t>::parent::type, atc>);
+static_assert(std::is_void_v<indexed_node_t<int, accessor_test_container_t>>);
+
+TEST_CASE("sygaldry node index")
+{
+    auto& in2 = indexed_node_t<in22, accessor_test_container_t>::get(accessor_test_container);
+    REQUIRE(&in2 == &accessor_test_container.c2.inputs.in2);
+}
 TEST_CASE("sygaldry component_tree_to_node_list")
 {
     constexpr auto flattened = component_tree_to_node_list(component_to_tree(accessor_test_container));
@@ -238,6 +256,9 @@ TEST_CASE("sygaldry component_tree_to_node_list")
     in1.extra_value = 3.14f;
     REQUIRE(accessor_test_container.c1.inputs.in1.extra_value == 3.14f);
 }
+static_assert(std::same_as< decltype(component_to_node_list(accessor_test_container))
+                          , decltype(component_tree_to_node_list(component_to_tree(accessor_test_container)))
+                          >);
 TEST_CASE("sygaldry node_list_filter")
 {
     constexpr auto& in1 = find<in11>(component_tree_to_node_list(component_to_tree(accessor_test_container)));
@@ -436,3 +457,44 @@ TEST_CASE("sygaldry for each benchmarks", "[!benchmark]")
         return allnodes;
     };
 }
+struct packed_component_t : name_<"packed">
+{
+    struct inputs_t {
+        button<"a", "", 0, tag_packed_flag> a;
+        bng<"b"> b;
+        slider_message<"c", "", float, 0.0f, 1.0f, 0.0f, tag_packed_flag> c;
+    } inputs;
+    struct outputs_t {
+        slider_message<"d", "", float, 0.0f, 1.0f, 0.0f, tag_packed_flag> d;
+        slider<"e"> e;
+    } outputs;
+};
+
+TEST_CASE("sygaldry packed flags", "[components][packed_flags]")
+{
+    static_assert(packed_flag_count<packed_component_t, node::input_endpoint> == 2);
+    static_assert(packed_flag_count<packed_component_t, node::output_endpoint> == 1);
+    static_assert(std::tuple_size_v<decltype(packed_flags<c1>{}.inputs.words)> == 0);
+    packed_component_t c{};
+    packed_flags<packed_component_t> flags{};
+    c.inputs.a = 1;
+    flags.bind(c);
+    REQUIRE(flags.inputs.entry != 0);
+    CHECK(flag_bit::bitsets[c.inputs.a.updated.bitset] == flags.inputs.words.data());
+    CHECK(c.inputs.c.updated.bit == 1); // its position among the packed inputs
+    CHECK(flags.inputs.test(0)); // the state is kept when binding
+    CHECK(flags.inputs.count() == 1);
+    c.inputs.b();
+    c.inputs.c = 0.5f;
+    c.outputs.d = 0.5f;
+    CHECK(flags.inputs.count() == 2);
+    CHECK(flags.outputs.any());
+    clear_input_flags(c, flags);
+    CHECK(not flags.inputs.any());
+    CHECK(not flag_state_of(c.inputs.a));
+    CHECK(not flag_state_of(c.inputs.b));
+    CHECK(not flag_state_of(c.inputs.c));
+    CHECK(flag_state_of(c.outputs.d));
+    clear_output_flags(c, flags);
+    CHECK(not flag_state_of(c.outputs.d));
+}
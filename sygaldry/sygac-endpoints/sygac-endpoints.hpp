@@ -9,6 +9,7 @@ SPDX-License-Identifier: MIT
 */
 
 #include <concepts>
+#include <cstdint>
 #include "sygah-consteval.hpp"
 
 namespace sygaldry {
@@ -34,6 +35,25 @@ constexpr auto get_range(const T&) { return T::range(); }
 
 template<has_range T>
 _consteval auto get_range() { return std::decay_t<T>::range(); }
+template<typename T>
+concept has_deadband = requires
+{
+    std::decay_t<T>::deadband().size();
+    std::decay_t<T>::deadband()[0];
+};
+
+template<typename T>
+concept has_relative_deadband = requires
+{
+    std::decay_t<T>::relative_deadband().size();
+    std::decay_t<T>::relative_deadband()[0];
+};
+
+template<has_deadband T>
+_consteval auto get_deadband() { return std::decay_t<T>::deadband(); }
+
+template<has_relative_deadband T>
+_consteval auto get_relative_deadband() { return std::decay_t<T>::relative_deadband(); }
 template <typename T, typename Y>
 concept strict_similar_to 
     =  requires (T t) { static_cast<Y>(t); }
@@ -69,11 +89,26 @@ concept BoolishFlag = requires (T t)
     t = T{}; // this is expected to be false when converted to bool
 };
 
+template<typename T>
+concept PackedFlag = requires (T f, std::uint32_t * words, unsigned char entry, unsigned char bit)
+{
+    { T::bitset_entry(words) } -> std::convertible_to<unsigned char>;
+    f.bind(entry, bit);
+    bool(f);
+    f = false;
+};
+
 template<typename T>
 concept UpdatedFlag = requires (T t)
 {
     t.updated;
-    requires std::same_as<bool, decltype(t.updated)>;
+    requires std::same_as<bool, decltype(t.updated)> || PackedFlag<decltype(t.updated)>;
+};
+
+template<typename T>
+concept PackedUpdatedFlag = UpdatedFlag<T> && requires (T t)
+{
+    requires PackedFlag<decltype(t.updated)>;
 };
 
 template<typename T> concept Flag = BoolishFlag<T> || UpdatedFlag<T>;
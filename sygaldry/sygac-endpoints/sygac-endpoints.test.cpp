@@ -63,6 +63,19 @@ TEST_CASE("sygaldry has_range", "[components][concepts][has_range]")
         auto r6 = get_range<const struct_with_range&>();
     }
 }
+struct struct_with_deadband : deadband_<0.01f, 0.02f> {};
+struct struct_with_relative_deadband : relative_deadband_<0.1f> {};
+TEST_CASE("sygaldry has_deadband", "[components][concepts][has_deadband]")
+{
+    static_assert(has_deadband<struct_with_deadband>);
+    static_assert(has_deadband<const struct_with_deadband&>);
+    static_assert(not has_deadband<struct_with_range>);
+    static_assert(not has_deadband<struct_with_relative_deadband>);
+    static_assert(has_relative_deadband<struct_with_relative_deadband>);
+    static_assert(not has_relative_deadband<struct_with_deadband>);
+    REQUIRE(get_deadband<struct_with_deadband&>()[1] == 0.02f);
+    REQUIRE(get_relative_deadband<struct_with_relative_deadband>()[0] == 0.1f);
+}
 TEST_CASE("sygaldry PersistentValue", "[components][concepts][PersistentValue]")
 {
     SECTION("similar_to")
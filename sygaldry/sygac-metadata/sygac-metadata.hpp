@@ -17,7 +17,7 @@ namespace sygaldry {
  */
 /// \{
 
-/*! \defgroup sygac-metadata sygac-metadata: Text Metadata Reflection
+/*! \defgroup sygac-metadata sygac-metadata: Metadata Reflection
  */
 /// \{
 
@@ -46,6 +46,46 @@ text_concept(date);
 
 #undef text_concept
 
+template<typename T>
+concept has_period = requires
+{
+    {std::decay_t<T>::period()} -> std::convertible_to<unsigned long>;
+};
+
+template<typename T>
+concept has_rate = requires
+{
+    {std::decay_t<T>::rate()} -> std::convertible_to<unsigned long>;
+};
+
+/// Get the period in microseconds declared by an entity's period or rate metadata, or zero if it has neither
+template<typename T>
+_consteval unsigned long period_of()
+{
+    if constexpr (has_period<T>) return std::decay_t<T>::period();
+    else if constexpr (has_rate<T>) return 1000000ul / std::decay_t<T>::rate();
+    else return 0;
+}
+
+template<typename T>
+concept change_driven = requires
+{
+    {std::decay_t<T>::change_driven()} -> std::convertible_to<bool>;
+} && std::decay_t<T>::change_driven();
+template<typename T>
+concept has_output_rate = requires
+{
+    {std::decay_t<T>::output_rate()} -> std::convertible_to<unsigned long>;
+};
+
+/// Get the shortest period in microseconds between two messages declared by an entity's output rate metadata, or zero if it has none
+template<typename T>
+_consteval unsigned long output_period_of()
+{
+    if constexpr (has_output_rate<T>) return 1000000ul / std::decay_t<T>::output_rate();
+    else return 0;
+}
+
 /// \}
 /// \}
 }
@@ -37,3 +37,27 @@ TEST_CASE("sygaldry name_of", "[components][concepts][name_of]")
         REQUIRE(string_view(name_of<const base_struct_with_name&>()) == string_view("yup"));
     }
 }
+
+struct base_struct_with_period {static constexpr unsigned long period() {return 2000;}};
+struct base_struct_with_rate {static constexpr unsigned long rate() {return 100;}};
+struct base_struct_with_change_driven {static constexpr bool change_driven() {return true;}};
+TEST_CASE("sygaldry period_of", "[components][concepts][period_of]")
+{
+    static_assert(has_period<base_struct_with_period>);
+    static_assert(has_rate<base_struct_with_rate>);
+    static_assert(not has_period<base_struct_with_name>);
+    static_assert(period_of<base_struct_with_period>() == 2000);
+    static_assert(period_of<const base_struct_with_period&>() == 2000);
+    static_assert(period_of<base_struct_with_rate>() == 10000);
+    static_assert(period_of<base_struct_with_name>() == 0);
+    static_assert(change_driven<base_struct_with_change_driven>);
+    static_assert(not change_driven<base_struct_with_period>);
+}
+struct base_struct_with_output_rate {static constexpr unsigned long output_rate() {return 50;}};
+TEST_CASE("sygaldry output_period_of", "[components][concepts][output_period_of]")
+{
+    static_assert(has_output_rate<base_struct_with_output_rate>);
+    static_assert(not has_output_rate<base_struct_with_rate>);
+    static_assert(output_period_of<const base_struct_with_output_rate&>() == 20000);
+    static_assert(output_period_of<base_struct_with_rate>() == 0);
+}
@@ -8,10 +8,17 @@ Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
 SPDX-License-Identifier: MIT
 */
 
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <type_traits>
 #include <boost/mp11.hpp>
 #include "sygac-functions.hpp"
 #include "sygac-components.hpp"
 #include "sygac-endpoints.hpp"
+#include "sygac-metadata.hpp"
 
 namespace sygaldry {
 
@@ -23,11 +30,53 @@ namespace sygaldry {
 */
 /// \{
 
+/// The subroutines of a component, as identified to a runtime profiler
+enum class runtime_subroutine { init, external_sources, main, external_destinations };
+
+/*! \brief Check if T is a component that the runtime should use to time the subroutines of all components
+
+\details When a runtime's container contains a runtime profiler, the runtime
+calls `timestamp()` before and after each subroutine of each component, and
+passes the difference to `record(index, subroutine, elapsed)`, where `index`
+is the index of the component in tree order. At most one runtime profiler may
+be present in a container. Runtimes that run subroutines on several threads
+serialize the calls to `record` and the profiler's own subroutines, but may
+call `timestamp()` from several threads at once.
+*/
+template<typename T>
+concept RuntimeProfiler = Component<T> && requires (T& t, std::size_t index, unsigned long elapsed)
+{
+    {t.timestamp()} -> std::convertible_to<unsigned long>;
+    t.record(index, runtime_subroutine::main, elapsed);
+};
+
+/*! \brief Check if T is a component that the runtime should notify at the beginning and end of each tick
+
+\details When a runtime's container contains a tick monitor, the runtime calls
+`tick_started()` before advancing its schedule in `tick`, and `tick_finished()`
+after the external destinations subroutines of the tick have run. At most one
+tick monitor may be present in a container.
+*/
+template<typename T>
+concept TickMonitor = Component<T> && requires (T& t)
+{
+    t.tick_started();
+    t.tick_finished();
+};
+
 /*! \defgroup sygac-runtime-detail sygac-runtime: Runtime Implementation Details
 These entities are used in the implementation of the Runtime class and should
 be considered private implementation details.
 */
 /// \{
+/// The return type of the subroutine described by `Reflection`, or `void` if there is no such subroutine
+template<typename Reflection>
+struct subroutine_result_of { using type = void; };
+
+template<typename Reflection>
+    requires requires {typename Reflection::return_type;}
+struct subroutine_result_of<Reflection> { using type = typename Reflection::return_type; };
+
 template<typename ComponentContainer, typename ... Args>
 struct impl_arg_pack
 {
@@ -57,6 +106,17 @@ struct to_arg_pack<Component, ComponentContainer, FuncRefl>
     using pack_t = boost::mp11::mp_rename<prepended, impl_arg_pack>;
 };
 
+/// Apply `f` to each clearable flag endpoint reachable through a subroutine argument extracted from the container
+template<typename ComponentContainer, typename Arg>
+void for_each_argument_flag(Arg& arg, auto&& f)
+{
+    using tag = typename indexed_node_t<Arg, ComponentContainer>::tag;
+    auto g = [&]<typename Y>(Y& endpoint) { if constexpr (ClearableFlag<Y>) f(endpoint); };
+    if constexpr (node::is_endpoint<tag>::value) g(arg);
+    else if constexpr (node::is_endpoints_container<tag>::value) boost::pfr::for_each_field(arg, g);
+    else for_each_output(arg, g); // plugin components and assemblies
+}
+
 template<typename Component, typename ComponentContainer>
 struct component_runtime
 {
@@ -65,6 +125,12 @@ struct component_runtime
     using ext_src_arg_pack = typename to_arg_pack<Component, ComponentContainer, external_sources_subroutine_reflection<Component>>::pack_t;
     using ext_dst_arg_pack = typename to_arg_pack<Component, ComponentContainer, external_destinations_subroutine_reflection<Component>>::pack_t;
 
+    /// The period in microseconds with which the component asks to be run, or zero if it should run every tick
+    static constexpr unsigned long period = period_of<Component>();
+
+    /// Whether the component's main subroutine should only be run when a flag it depends on is set
+    static constexpr bool is_change_driven = change_driven<Component>;
+
     Component& component;
     init_arg_pack init_args;
     main_arg_pack main_args;
@@ -74,10 +140,10 @@ struct component_runtime
     constexpr component_runtime(Component& comp, ComponentContainer& cont)
     : component{comp}, init_args{cont}, main_args{cont}, ext_src_args{cont}, ext_dst_args{cont} {}
 
-    void init() const
+    auto init() const
     {
         if constexpr (requires {&Component::init;})
-            tpl::apply([&](auto& ... args) {component.init(args...);}, init_args.pack);
+            return tpl::apply([&](auto& ... args) {return component.init(args...);}, init_args.pack);
     }
 
     void external_sources() const
@@ -86,12 +152,31 @@ struct component_runtime
             tpl::apply([&](auto& ... args) {component.external_sources(args...);}, ext_src_args.pack);
     }
 
-    void main() const
+    /// Check whether any clearable flag that the main subroutine depends on is set, or if there are no such flags
+    bool main_dependencies_updated() const
+    {
+        bool has_dependencies = false;
+        bool updated = false;
+        auto check = [&](auto& endpoint)
+        {
+            has_dependencies = true;
+            updated = updated || flag_state_of(endpoint);
+        };
+        for_each_input(component, [&]<typename Y>(Y& endpoint) { if constexpr (ClearableFlag<Y>) check(endpoint); });
+        tpl::apply([&](auto& ... args) { (for_each_argument_flag<ComponentContainer>(args, check), ...); }, main_args.pack);
+        return updated || not has_dependencies;
+    }
+
+    auto main() const
     {
+        using result_t = typename subroutine_result_of<main_subroutine_reflection<Component>>::type;
+        if constexpr (is_change_driven)
+            if (not main_dependencies_updated()) return result_t();
         if constexpr (requires {&Component::operator();})
-            tpl::apply(component, main_args.pack);
+            return tpl::apply(component, main_args.pack);
         else if constexpr (requires {&Component::main;})
-            tpl::apply([&](auto& ... args) {component.main(args...);}, main_args.pack);
+            return tpl::apply([&](auto& ... args) {return component.main(args...);}, main_args.pack);
+        else return result_t();
     }
 
     void external_destinations() const
@@ -113,6 +198,232 @@ constexpr auto component_to_runtime_tuple(ComponentContainer& cont)
     // if there's only one component, `component_filter_by_tag` returns the tagged component directly
     else return tpl::make_tuple(component_runtime{tup.ref, cont});
 }
+
+/// Compile-time schedule for the component runtimes in a `Runtime`
+template<typename ComponentRuntimes>
+struct runtime_schedule
+{
+    /// The number of component runtimes
+    static constexpr std::size_t size = std::tuple_size_v<ComponentRuntimes>;
+
+    /// The period declared by each component, or zero for components that should run every tick
+    static constexpr std::array<unsigned long, size> periods = []<std::size_t ... I>(std::index_sequence<I...>)
+    {
+        return std::array<unsigned long, size>{std::tuple_element_t<I, ComponentRuntimes>::period...};
+    }(std::make_index_sequence<size>{});
+
+    /// The duration of one tick in microseconds, or zero if no component declares a period
+    static constexpr unsigned long tick_period = []()
+    {
+        unsigned long gcd = 0;
+        for (auto period : periods) gcd = std::gcd(gcd, period);
+        return gcd;
+    }();
+
+    /// The position of a scheduled component in the schedule; it is due in ticks where `tick % divisor == phase`
+    struct slot { unsigned long divisor; unsigned long phase; };
+
+    /// The slot assigned to each component; components without a period are always due
+    static constexpr std::array<slot, size> slots = []()
+    {
+        std::array<slot, size> ret{};
+        unsigned long scheduled = 0;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            if (periods[i] == 0) ret[i] = {1, 0};
+            else
+            {
+                unsigned long divisor = periods[i] / tick_period;
+                ret[i] = {divisor, scheduled++ % divisor};
+            }
+        }
+        return ret;
+    }();
+
+    /// A set of flags marking every component as due
+    static constexpr std::array<bool, size> all_due = []()
+    {
+        std::array<bool, size> ret{};
+        ret.fill(true);
+        return ret;
+    }();
+
+    /// Count the ticks in `[first, first + count)` in which the component at `index` is due
+    static constexpr std::uint64_t due_count(std::size_t index, std::uint64_t first, std::uint64_t count)
+    {
+        auto [divisor, phase] = slots[index];
+        // the number of due ticks in [0, end)
+        auto before = [&](std::uint64_t end) -> std::uint64_t
+        {
+            return end <= phase ? 0 : (end - phase - 1) / divisor + 1;
+        };
+        return before(first + count) - before(first);
+    }
+};
+
+/// Compile-time graph of the dependencies between the main subroutines of the component runtimes in a `Runtime`
+template<typename ComponentRuntimes>
+struct main_dependency_graph
+{
+    /// The number of components
+    static constexpr std::size_t size = std::tuple_size_v<ComponentRuntimes>;
+
+    /// The type of the component at index `I` in tree order
+    template<std::size_t I>
+    using component_t = std::remove_cvref_t<decltype(std::declval<std::tuple_element_t<I, ComponentRuntimes>&>().component)>;
+
+    /// Whether the tree of `T` contains a node of type `Y`
+    template<typename T, typename Y>
+    static constexpr bool contains = not std::is_void_v<indexed_node_t<Y, T>>;
+
+    /// Whether the component at index `I` is, or contains, a node of type `T`, or is contained in an assembly of type `T`
+    template<std::size_t I, typename T>
+    static constexpr bool owns()
+    {
+        if constexpr (contains<component_t<I>, T>) return true;
+        else if constexpr (Assembly<T>) return contains<T, component_t<I>>;
+        else return false;
+    }
+
+    /// Mark the owners of nodes of type `T`
+    template<typename T>
+    static constexpr std::array<bool, size> owners_of()
+    {
+        return []<std::size_t ... I>(std::index_sequence<I...>)
+        {
+            return std::array<bool, size>{owns<I, T>()...};
+        }(std::make_index_sequence<size>{});
+    }
+
+    /// Mark the components whose state the main subroutine of the component at index `I` may access
+    template<std::size_t I>
+    static constexpr std::array<bool, size> footprint_of()
+    {
+        std::array<bool, size> ret{};
+        ret[I] = true;
+        using reflection = main_subroutine_reflection<component_t<I>>;
+        if constexpr (reflection::exists::value)
+        {
+            using args = boost::mp11::mp_transform<std::remove_cvref_t, typename reflection::arguments>;
+            boost::mp11::mp_for_each<boost::mp11::mp_transform<boost::mp11::mp_identity, args>>(
+            [&]<typename Arg>(boost::mp11::mp_identity<Arg>)
+            {
+                auto owners = owners_of<Arg>();
+                for (std::size_t j = 0; j < size; ++j) ret[j] = ret[j] || owners[j];
+            });
+        }
+        return ret;
+    }
+
+    /// The footprint of each component's main subroutine
+    static constexpr std::array<std::array<bool, size>, size> footprints = []<std::size_t ... I>(std::index_sequence<I...>)
+    {
+        return std::array<std::array<bool, size>, size>{footprint_of<I>()...};
+    }(std::make_index_sequence<size>{});
+
+    /// Whether the main subroutine of component `i` reads the state of another component `j`
+    static constexpr bool reads(std::size_t i, std::size_t j) { return i != j && footprints[i][j]; }
+
+    struct sort_result
+    {
+        std::array<std::size_t, size> order;
+        bool acyclic;
+    };
+
+    static constexpr sort_result sorted = []()
+    {
+        sort_result ret{{}, true};
+        std::array<bool, size> placed{};
+        for (std::size_t n = 0; n < size; ++n)
+        {
+            std::size_t next = size;
+            for (std::size_t i = 0; i < size && next == size; ++i)
+            {
+                if (placed[i]) continue;
+                bool ready = true;
+                for (std::size_t j = 0; j < size; ++j)
+                    if (not placed[j] && reads(i, j)) ready = false;
+                if (ready) next = i;
+            }
+            if (next == size)
+            {
+                ret.acyclic = false;
+                return ret;
+            }
+            placed[next] = true;
+            ret.order[n] = next;
+        }
+        return ret;
+    }();
+
+    /// Whether the dependencies between main subroutines are free of cycles
+    static constexpr bool acyclic = sorted.acyclic;
+
+    /// The indices of the components in the order in which their main subroutines are run
+    static constexpr std::array<std::size_t, size> order = sorted.order;
+
+    /// The position of each component in `order`
+    static constexpr std::array<std::size_t, size> position = []()
+    {
+        std::array<std::size_t, size> ret{};
+        for (std::size_t n = 0; n < size; ++n) ret[order[n]] = n;
+        return ret;
+    }();
+};
+
+/// Storage for the suspended result of a subroutine with return type `R`; empty unless `R` is \ref Resumable
+template<typename R>
+struct pending_subroutine
+{
+    static constexpr bool done() { return true; }
+    void resume() {}
+};
+
+template<Resumable R>
+struct pending_subroutine<R>
+{
+    union { R result; };
+    constexpr pending_subroutine() : result{} {}
+    constexpr ~pending_subroutine() { if (not std::is_constant_evaluated()) result.~R(); }
+    bool done() const { return result.done(); }
+    void resume() { result.resume(); }
+};
+
+/// The suspended init and main subroutines of the component of a component runtime
+template<typename ComponentRuntime>
+struct pending_subroutines
+{
+    using component_t = std::remove_cvref_t<decltype(std::declval<ComponentRuntime&>().component)>;
+    pending_subroutine<typename subroutine_result_of<init_subroutine_reflection<component_t>>::type> init;
+    pending_subroutine<typename subroutine_result_of<main_subroutine_reflection<component_t>>::type> main;
+};
+
+template<typename ComponentRuntime>
+using runtime_packed_flags = packed_flags<std::remove_cvref_t<decltype(std::declval<ComponentRuntime&>().component)>>;
+
+/// Placeholder for an optional hook of a `Runtime`, such as its profiler, when its container doesn't contain one
+struct no_runtime_hook {};
+
+template<typename Y>
+struct tagged_is_runtime_profiler
+: std::bool_constant<std::same_as<typename Y::tag, node::component> && RuntimeProfiler<typename Y::type>> {};
+
+template<typename Y>
+struct tagged_is_tick_monitor
+: std::bool_constant<std::same_as<typename Y::tag, node::component> && TickMonitor<typename Y::type>> {};
+
+/// Find the component satisfying `tagged_is_hook` in a container, returning a tagged reference to it, or `no_runtime_hook` if there is none
+template<template<typename> typename tagged_is_hook, typename ComponentContainer>
+constexpr auto find_runtime_hook(ComponentContainer& cont)
+{
+    using found = decltype(component_filter<tagged_is_hook>(cont));
+    if constexpr (std::is_void_v<found>) return no_runtime_hook{};
+    else
+    {
+        static_assert(not Tuple<found>, "A runtime can use at most one component for each of its hooks");
+        return component_filter<tagged_is_hook>(cont);
+    }
+}
 /// \}
 
 
@@ -135,6 +446,18 @@ a simple example, see [the implementation of the One Bit Bongo][bongo].
 
 [bongo]: instruments/one-bit-bongo/one-bit-bongo-esp32/one-bit-bongo-esp32.lili.md
 
+Components may also declare a period or rate with which they should be run,
+using e.g. `period_<1000>` or `rate_<1000>`. The `Runtime` derives a schedule
+from these declarations at compile time, and only runs each component in the
+ticks where it is due. Call `tick(unsigned long)` with a timestamp in
+microseconds to follow the schedule in real time, and `missed_deadlines()` to
+find out whether any component fell behind.
+
+If the container includes a component satisfying \ref RuntimeProfiler, the
+`Runtime` times each call to the subroutines of every component and reports
+the elapsed time to that component. Similarly, a component satisfying
+\ref TickMonitor is notified at the beginning and end of every tick.
+
 \warning It is important that this class should be declared `constexpr` when it is
 instantiated in order to avoid traversing the component tree at compile time, e.g.
 `constexpr auto runtime = Runtime{container};`.
@@ -169,6 +492,12 @@ struct Runtime
     */
     decltype(component_to_runtime_tuple(std::declval<ComponentContainer&>())) component_runtimes;
 
+    /// The runtime profiler found in the container, or `no_runtime_hook` if there is none; see \ref RuntimeProfiler
+    decltype(find_runtime_hook<tagged_is_runtime_profiler>(std::declval<ComponentContainer&>())) profiler;
+
+    /// The tick monitor found in the container, or `no_runtime_hook` if there is none; see \ref TickMonitor
+    decltype(find_runtime_hook<tagged_is_tick_monitor>(std::declval<ComponentContainer&>())) monitor;
+
     /*! \brief The constructor, e.g. `constexpr auto runtime = Runtime{container};`
 
     \detail The constructor permits the template type parameter to be deduced by the compiler. It's
@@ -178,43 +507,286 @@ struct Runtime
     \param[in,out] c The component container managed by the `Runtime`. See \ref container.
 
     */
-    constexpr Runtime(ComponentContainer& c) : container{c}, component_runtimes{component_to_runtime_tuple(c)} {};
+    constexpr Runtime(ComponentContainer& c)
+    : container{c}, component_runtimes{component_to_runtime_tuple(c)}, profiler{find_runtime_hook<tagged_is_runtime_profiler>(c)}
+    , monitor{find_runtime_hook<tagged_is_tick_monitor>(c)} {};
+
+    /// The schedule derived from the period or rate metadata of the components in the container
+    using schedule = runtime_schedule<decltype(component_runtimes)>;
+
+    /// The duration of a tick in microseconds, or zero if no component declares a period
+    static constexpr unsigned long tick_period = schedule::tick_period;
+
+    /// The index of the next tick in the schedule
+    mutable std::uint64_t next_tick = 0;
+
+    /// Whether each component is due in the current tick
+    mutable std::array<bool, schedule::size> due = schedule::all_due;
+
+    /// Whether each component ran in the previous tick
+    mutable std::array<bool, schedule::size> ran = schedule::all_due;
+
+    /// The number of deadlines missed by each component; see `missed_deadlines()`
+    mutable std::array<unsigned long, schedule::size> missed = {};
+
+    /// Apply the functor `f(runtime, index)` to each component runtime, with `index` as a `std::integral_constant`
+    void for_each_runtime(auto&& f) const
+    {
+        [&]<std::size_t ... I>(std::index_sequence<I...>)
+        {
+            (f(tpl::get<I>(component_runtimes), std::integral_constant<std::size_t, I>{}), ...);
+        }(std::make_index_sequence<schedule::size>{});
+    }
+
+    /// Check whether the component runtime at `index` is due in the current tick
+    template<std::size_t I>
+    bool is_due(std::integral_constant<std::size_t, I>) const
+    {
+        if constexpr (schedule::periods[I] == 0) return true;
+        else return due[I];
+    }
+
+    /// Mark the components due in any of the `count` ticks beginning with `first` and count missed deadlines
+    void schedule_ticks(std::uint64_t first, std::uint64_t count) const
+    {
+        for_each_runtime([&](auto&, auto i)
+        {
+            if constexpr (schedule::periods[i] != 0)
+            {
+                auto n = schedule::due_count(i, first, count);
+                due[i] = n > 0;
+                if (n > 1) missed[i] += n - 1;
+            }
+        });
+        next_tick = first + count;
+    }
+
+    /// The dependencies between the main subroutines of the components in the container
+    using main_graph = main_dependency_graph<decltype(component_runtimes)>;
+
+    static_assert(main_graph::acyclic,
+            "The main subroutines of some components in this container read each other's state in a cycle, "
+            "so they can't be ordered so that every component runs after the components it reads from");
+
+    /// Apply the functor `f(runtime, index)` to each component runtime in the order in which main subroutines are run
+    void for_each_runtime_in_main_order(auto&& f) const
+    {
+        [&]<std::size_t ... N>(std::index_sequence<N...>)
+        {
+            (f( tpl::get<main_graph::order[N]>(component_runtimes)
+              , std::integral_constant<std::size_t, main_graph::order[N]>{}
+              ), ...);
+        }(std::make_index_sequence<schedule::size>{});
+    }
+
+    /// The suspended init and main subroutines of each component
+    mutable boost::mp11::mp_transform<pending_subroutines, decltype(component_runtimes)> pending{};
+
+    /// Run the init subroutine of the component runtime `r` at `index`, keeping its result if it suspends
+    template<std::size_t I>
+    void run_init(auto& r, std::integral_constant<std::size_t, I>) const
+    {
+        if constexpr (std::is_void_v<decltype(r.init())>) r.init();
+        else tpl::get<I>(pending).init.result = r.init();
+    }
+
+    /*! \brief Run the main subroutine of the component runtime `r` at `index`, or resume a suspended subroutine of the component
+
+    \details Runtimes built on this one, such as the \ref page-sygbp-parallel_runtime,
+    should run main subroutines through this method so that suspended subroutines
+    are resumed.
+    */
+    template<std::size_t I>
+    void run_main(auto& r, std::integral_constant<std::size_t, I>) const
+    {
+        auto& p = tpl::get<I>(pending);
+        if (not p.init.done()) p.init.resume();
+        else if (not p.main.done()) p.main.resume();
+        else if constexpr (std::is_void_v<decltype(r.main())>) r.main();
+        else p.main.result = r.main();
+    }
+
+    /// Storage for the packed flags of each component
+    mutable boost::mp11::mp_transform<runtime_packed_flags, decltype(component_runtimes)> packed_flags{};
+
+    /// The packed flags of the component runtime at `index`
+    template<std::size_t I>
+    auto& packed_flags_of(std::integral_constant<std::size_t, I>) const { return tpl::get<I>(packed_flags); }
+
+    /// Whether the subroutine `S` of a component of type `T` is timed by the runtime
+    template<runtime_subroutine S, typename T>
+    static constexpr bool profiles = not std::same_as<decltype(profiler), no_runtime_hook>
+            && ( S == runtime_subroutine::init ? has_init_subroutine<T>
+               : S == runtime_subroutine::external_sources ? has_external_sources_subroutine<T>
+               : S == runtime_subroutine::main ? has_main_subroutine<T>
+               : has_external_destinations_subroutine<T>
+               );
+
+    /// Call `f`, which runs the subroutine `S` of the component runtime `r` at `index`, timing it if the container has a runtime profiler
+    template<runtime_subroutine S>
+    void profile(auto& r, std::size_t index, auto&& f) const
+    {
+        using component_t = std::remove_cvref_t<decltype(r.component)>;
+        if constexpr (not profiles<S, component_t>) f();
+        else
+        {
+            auto start = profiler.ref.timestamp();
+            f();
+            profiler.ref.record(index, S, profiler.ref.timestamp() - start);
+        }
+    }
+    /// Call `f` as `profile` does, with `lock` held while the elapsed time is recorded and while the profiler's own subroutines run
+    template<runtime_subroutine S>
+    void profile(auto& r, std::size_t index, auto&& f, auto& lock) const
+    {
+        using component_t = std::remove_cvref_t<decltype(r.component)>;
+        if constexpr (not profiles<S, component_t>) f();
+        else if constexpr (std::same_as<component_t, std::remove_cvref_t<decltype(profiler.ref)>>)
+        {
+            lock.lock();
+            profile<S>(r, index, f);
+            lock.unlock();
+        }
+        else
+        {
+            auto start = profiler.ref.timestamp();
+            f();
+            auto elapsed = profiler.ref.timestamp() - start;
+            lock.lock();
+            profiler.ref.record(index, S, elapsed);
+            lock.unlock();
+        }
+    }
+
+    /// Notify the tick monitor, if any, that a tick is beginning
+    void tick_started() const
+    {
+        if constexpr (not std::same_as<decltype(monitor), no_runtime_hook>) monitor.ref.tick_started();
+    }
+
+    /// Notify the tick monitor, if any, that a tick has ended
+    void tick_finished() const
+    {
+        if constexpr (not std::same_as<decltype(monitor), no_runtime_hook>) monitor.ref.tick_finished();
+    }
 
     /// Initialize all components in the container.
     void init() const
     {
+        for_each_runtime([&](auto& r, auto i){packed_flags_of(i).bind(r.component);});
         for_each_endpoint(container, []<typename T>(T& ep)
         {
             initialize_endpoint(ep);
         });
-        tuple_for_each(component_runtimes, [](auto& r){r.init();});
+        for_each_runtime([&](auto& r, auto i){profile<runtime_subroutine::init>(r, i, [&](){run_init(r, i);});});
     }
 
-    /// Clear input flags, then run the external sources subroutine of all components in the container that have one.
+    /// Clear input flags of components that ran in the previous tick, then run the external sources subroutine of all components due in this tick that have one.
     void external_sources() const
     {
-        tuple_for_each(component_runtimes, [](auto& r){clear_input_flags(r.component);});
-        tuple_for_each(component_runtimes, [](auto& r){r.external_sources();});
+        for_each_runtime([&](auto& r, auto i){if (ran[i]) clear_input_flags(r.component, packed_flags_of(i));});
+        for_each_runtime([&](auto& r, auto i)
+        {
+            if (is_due(i)) profile<runtime_subroutine::external_sources>(r, i, [&](){r.external_sources();});
+        });
     }
 
-    /// Run the main subroutine of all components in the container
-    void main() const { tuple_for_each(component_runtimes, [](auto& r){r.main();}); }
+    /// Run the main subroutine of all components in the container that are due in this tick, in dependency order
+    void main() const
+    {
+        for_each_runtime_in_main_order([&](auto& r, auto i)
+        {
+            if (is_due(i)) profile<runtime_subroutine::main>(r, i, [&](){run_main(r, i);});
+        });
+    }
 
-    /// Run the external destinations subroutine of all components in the container that have one, then clear output flags.
+    /// Run the external destinations subroutine of all components due in this tick that have one, then clear output flags.
     void external_destinations() const
     {
-        tuple_for_each(component_runtimes, [](auto& r){r.external_destinations();});
-        tuple_for_each(component_runtimes, [](auto& r){clear_output_flags(r.component);});
+        for_each_runtime([&](auto& r, auto i)
+        {
+            if (is_due(i)) profile<runtime_subroutine::external_destinations>(r, i, [&](){r.external_destinations();});
+        });
+        for_each_runtime([&](auto& r, auto i){clear_output_flags(r.component, packed_flags_of(i));});
+        ran = due;
     }
 
-    /// Run external sources, main, and external destinations, clearing flags appropriately
+    /// Advance the schedule by one tick
+    void advance() const { schedule_ticks(next_tick, 1); }
+
+    /// Run external sources, main, and external destinations, clearing flags appropriately, advancing the schedule by one tick
     void tick() const
     {
+        tick_started();
+        advance();
         external_sources();
         main();
         external_destinations();
+        tick_finished();
     }
 
+    /// The timestamp passed to the previous call to `tick(unsigned long)`
+    mutable unsigned long last_time = 0;
+
+    /// Time elapsed towards the next tick since the last tick in the schedule
+    mutable unsigned long remainder = 0;
+
+    /// Whether `advance(unsigned long)` has been called before
+    mutable bool started = false;
+
+    /// Advance the schedule according to the time elapsed since the last call, given a timestamp in microseconds
+    void advance(unsigned long now) const
+    {
+        if constexpr (tick_period == 0) advance();
+        else
+        {
+            std::uint64_t count = 1;
+            if (started)
+            {
+                remainder += now - last_time;
+                count = remainder / tick_period;
+                remainder -= count * tick_period;
+            }
+            started = true;
+            last_time = now;
+            schedule_ticks(next_tick, count);
+        }
+    }
+
+    /// Run a tick, advancing the schedule according to the time elapsed since the last call, given a timestamp in microseconds
+    void tick(unsigned long now) const
+    {
+        tick_started();
+        advance(now);
+        external_sources();
+        main();
+        external_destinations();
+        tick_finished();
+    }
+
+    /// Get the time in microseconds from the given timestamp until the next tick of the schedule, or the maximum `unsigned long` if no component declares a period
+    unsigned long time_to_next_tick(unsigned long now) const
+    {
+        if constexpr (tick_period == 0) return std::numeric_limits<unsigned long>::max();
+        else
+        {
+            if (not started) return 0;
+            auto elapsed = remainder + (now - last_time);
+            return elapsed >= tick_period ? 0 : tick_period - elapsed;
+        }
+    }
+
+    /// Get the total number of deadlines missed by all components since the runtime began
+    unsigned long missed_deadlines() const
+    {
+        unsigned long ret = 0;
+        for (auto m : missed) ret += m;
+        return ret;
+    }
+
+    /// Get the number of deadlines missed by the component at the given index in tree order
+    unsigned long missed_deadlines(std::size_t index) const { return missed[index]; }
+
     /// A wrapper for `init` and `tick` that loops indefinitely, intended for instruments with simple requirements.
     int app_main() const { for (init(); true; tick()) {} return 0; }
 };
@@ -121,3 +121,455 @@ TEST_CASE("sygaldry runtime tuple")
     tpl::apply([](auto& ... runtime) {(runtime.main(), ...);}, runtime_tuple);
     CHECK(runtime_tuple_components.tc1.outputs.out1.value == 43); // main routines are called
 }
+template<string_literal str, unsigned long us>
+struct periodic_component_t : name_<str>, period_<us>
+{
+    struct inputs_t {
+        bng<"bang in"> bang_in;
+    } inputs;
+
+    struct outputs_t {
+        struct count_t {
+            int value;
+        } count;
+        struct bangs_t {
+            int value;
+        } bangs;
+    } outputs;
+
+    void main()
+    {
+        ++outputs.count.value;
+        if (inputs.bang_in) ++outputs.bangs.value;
+    }
+};
+
+struct aperiodic_component_t : name_<"aperiodic">
+{
+    struct outputs_t {
+        struct count_t {
+            int value;
+        } count;
+    } outputs;
+
+    void main() { ++outputs.count.value; }
+};
+
+struct scheduled_components_t
+{
+    periodic_component_t<"fast", 1000> fast;
+    periodic_component_t<"slow", 3000> slow;
+    periodic_component_t<"slow2", 3000> slow2;
+    aperiodic_component_t aperiodic;
+};
+
+TEST_CASE("sygaldry runtime schedule")
+{
+    // each section runs its own container from tick 0
+    scheduled_components_t c{};
+    auto scheduled_runtime = Runtime{c};
+    static_assert(decltype(scheduled_runtime)::tick_period == 1000);
+    scheduled_runtime.init();
+
+    SECTION("tick advances the schedule by one tick")
+    {
+        for (int i = 0; i < 3; ++i) scheduled_runtime.tick(); // ticks 0 to 2
+        CHECK(c.fast.outputs.count.value == 3);
+        CHECK(c.slow.outputs.count.value == 1); // components with the same period are staggered
+        CHECK(c.slow2.outputs.count.value == 1);
+        CHECK(c.aperiodic.outputs.count.value == 3);
+        CHECK(scheduled_runtime.missed_deadlines() == 0);
+    }
+
+    SECTION("tick with clock advances the schedule according to the elapsed time")
+    {
+        for (int i = 0; i < 3; ++i) scheduled_runtime.tick(); // ticks 0 to 2
+        scheduled_runtime.tick(10000); // tick 3
+        CHECK(c.fast.outputs.count.value == 4);
+        CHECK(c.slow.outputs.count.value == 1);
+        CHECK(c.slow2.outputs.count.value == 1);
+        CHECK(c.aperiodic.outputs.count.value == 4);
+
+        scheduled_runtime.tick(10500); // less than one tick elapsed
+        CHECK(c.fast.outputs.count.value == 4);
+        CHECK(c.aperiodic.outputs.count.value == 5); // components without a period run anyway
+        CHECK(scheduled_runtime.time_to_next_tick(10500) == 500);
+        CHECK(scheduled_runtime.time_to_next_tick(10800) == 200);
+
+        scheduled_runtime.tick(11000); // tick 4
+        CHECK(c.fast.outputs.count.value == 5);
+        CHECK(c.slow.outputs.count.value == 2);
+        CHECK(c.slow2.outputs.count.value == 1);
+        CHECK(scheduled_runtime.missed_deadlines() == 0);
+
+        scheduled_runtime.tick(17000); // ticks 5 to 10
+        CHECK(c.fast.outputs.count.value == 6); // each component runs once
+        CHECK(c.slow.outputs.count.value == 3);
+        CHECK(c.slow2.outputs.count.value == 2);
+        CHECK(scheduled_runtime.missed_deadlines(0) == 5); // and counts the periods that elapsed without it running
+        CHECK(scheduled_runtime.missed_deadlines(1) == 1);
+        CHECK(scheduled_runtime.missed_deadlines(2) == 1);
+        CHECK(scheduled_runtime.missed_deadlines(3) == 0);
+        CHECK(scheduled_runtime.missed_deadlines() == 7);
+        CHECK(scheduled_runtime.time_to_next_tick(17000) == 1000);
+        CHECK(scheduled_runtime.time_to_next_tick(18500) == 0); // the next tick is already late
+    }
+
+    SECTION("input flags are held until a scheduled component runs")
+    {
+        for (int i = 0; i < 3; ++i) scheduled_runtime.tick(); // ticks 0 to 2; slow runs in tick 1
+        c.slow.inputs.bang_in();
+        scheduled_runtime.tick(); // tick 3
+        CHECK(c.slow.outputs.bangs.value == 0);
+        CHECK(true == (bool)c.slow.inputs.bang_in);
+        scheduled_runtime.tick(); // tick 4
+        CHECK(c.slow.outputs.bangs.value == 1);
+        scheduled_runtime.tick(); // tick 5
+        CHECK(false == (bool)c.slow.inputs.bang_in);
+    }
+}
+struct change_driven_source_t : name_<"source">
+{
+    struct outputs_t {
+        bng<"bang out"> bang_out;
+        struct count_t {
+            int value;
+        } count;
+    } outputs;
+
+    void main() { ++outputs.count.value; }
+};
+
+struct change_driven_sink_t : name_<"sink">, change_driven_
+{
+    struct inputs_t {
+        bng<"bang in"> bang_in;
+    } inputs;
+
+    struct outputs_t {
+        struct count_t {
+            int value;
+        } count;
+    } outputs;
+
+    void main(const change_driven_source_t::outputs_t&) { ++outputs.count.value; }
+};
+
+struct change_driven_orphan_t : name_<"orphan">, change_driven_
+{
+    struct outputs_t {
+        struct count_t {
+            int value;
+        } count;
+    } outputs;
+
+    void main() { ++outputs.count.value; }
+};
+
+struct change_driven_components_t
+{
+    change_driven_source_t source;
+    change_driven_sink_t sink;
+    change_driven_orphan_t orphan;
+};
+
+constinit change_driven_components_t change_driven_components{};
+constexpr auto change_driven_runtime = Runtime{change_driven_components};
+TEST_CASE("sygaldry runtime change driven")
+{
+    auto& c = change_driven_runtime.container;
+    change_driven_runtime.init();
+    change_driven_runtime.tick();
+    CHECK(c.source.outputs.count.value == 1);
+    CHECK(c.sink.outputs.count.value == 0); // skipped when no flags are set
+    CHECK(c.orphan.outputs.count.value == 1); // run anyway if there are no flags to check
+
+    c.source.outputs.bang_out();
+    change_driven_runtime.main();
+    change_driven_runtime.external_destinations();
+    CHECK(c.sink.outputs.count.value == 1); // run when a throughpoint flag is set
+
+    change_driven_runtime.external_sources();
+    c.sink.inputs.bang_in();
+    change_driven_runtime.main();
+    change_driven_runtime.external_destinations();
+    CHECK(c.sink.outputs.count.value == 2); // run when an input flag is set
+
+    change_driven_runtime.tick();
+    CHECK(c.sink.outputs.count.value == 2);
+}
+struct countdown_t
+{
+    int remaining = 0;
+    bool done() const { return remaining == 0; }
+    void resume() { --remaining; }
+};
+
+struct resumable_component_t : name_<"resumable">
+{
+    struct outputs_t {
+        struct starts_t {
+            int value;
+        } starts;
+    } outputs;
+
+    countdown_t init() { return {2}; }
+    countdown_t main() { ++outputs.starts.value; return {1}; }
+};
+
+struct resumable_components_t
+{
+    resumable_component_t component;
+    aperiodic_component_t aperiodic;
+};
+
+TEST_CASE("sygaldry Runtime resumable subroutines", "[runtime][resumable]")
+{
+    static_assert(std::is_empty_v<pending_subroutine<void>>);
+    static resumable_components_t c{};
+    constexpr auto runtime = Runtime{c};
+    runtime.init();
+    runtime.tick();
+    runtime.tick();
+    CHECK(c.component.outputs.starts.value == 0); // init is resumed until it is done
+    runtime.tick();
+    CHECK(c.component.outputs.starts.value == 1);
+    runtime.tick();
+    CHECK(c.component.outputs.starts.value == 1); // main is resumed instead of being started again
+    runtime.tick();
+    CHECK(c.component.outputs.starts.value == 2);
+    CHECK(c.aperiodic.outputs.count.value == 5); // other components keep running
+}
+struct packed_component_t : name_<"packed">
+{
+    struct inputs_t {
+        slider_message<"in", "", float, 0.0f, 1.0f, 0.0f, tag_packed_flag> in;
+        slider_message<"other", "", float, 0.0f, 1.0f, 0.0f> other;
+    } inputs;
+    struct outputs_t {
+        slider_message<"out", "", float, 0.0f, 1.0f, 0.0f, tag_packed_flag> out;
+    } outputs;
+    void main() { if (flag_state_of(inputs.in)) outputs.out = inputs.in; }
+};
+
+struct packed_components_t
+{
+    packed_component_t packed;
+};
+
+TEST_CASE("sygaldry Runtime packed flags", "[runtime][packed_flags]")
+{
+    static packed_components_t c{};
+    constexpr auto runtime = Runtime{c};
+    constexpr auto index = std::integral_constant<std::size_t, 0>{};
+    runtime.init();
+    CHECK(flag_bit::bitsets[c.packed.inputs.in.updated.bitset] == runtime.packed_flags_of(index).inputs.words.data());
+    runtime.tick();
+    c.packed.inputs.in = 0.5f;
+    c.packed.inputs.other = 0.5f;
+    CHECK(runtime.packed_flags_of(index).inputs.count() == 1);
+    runtime.main();
+    CHECK(runtime.packed_flags_of(index).outputs.any());
+    runtime.external_destinations();
+    CHECK(not flag_state_of(c.packed.outputs.out));
+    CHECK(c.packed.outputs.out == 0.5f);
+    runtime.external_sources();
+    CHECK(not runtime.packed_flags_of(index).inputs.any());
+    CHECK(not flag_state_of(c.packed.inputs.in));
+    CHECK(not flag_state_of(c.packed.inputs.other));
+}
+struct ordered_producer_t : name_<"producer">
+{
+    struct outputs_t {
+        struct count_t {
+            int value;
+        } count;
+    } outputs;
+
+    void main() { ++outputs.count.value; }
+};
+
+struct ordered_consumer_t : name_<"consumer">
+{
+    struct outputs_t {
+        struct seen_t {
+            int value;
+        } seen;
+    } outputs;
+
+    void main(const ordered_producer_t::outputs_t& producer) { outputs.seen.value = producer.count.value; }
+};
+
+struct ordered_plugin_user_t : name_<"plugin user">
+{
+    struct outputs_t {
+        struct seen_t {
+            int value;
+        } seen;
+    } outputs;
+
+    void main(ordered_consumer_t& consumer) { outputs.seen.value = consumer.outputs.seen.value; }
+};
+
+struct ordered_sensors_t
+{
+    ordered_producer_t producer;
+};
+
+struct ordered_assembly_user_t : name_<"assembly user">
+{
+    struct outputs_t {
+        struct seen_t {
+            int value;
+        } seen;
+    } outputs;
+
+    void main(ordered_sensors_t& sensors) { outputs.seen.value = sensors.producer.outputs.count.value; }
+};
+
+struct ordered_components_t
+{
+    ordered_plugin_user_t plugin_user;
+    ordered_assembly_user_t assembly_user;
+    ordered_consumer_t consumer;
+    ordered_sensors_t sensors;
+};
+
+struct cycle_a_t;
+struct cycle_b_t;
+
+struct cycle_a_t : name_<"a">
+{
+    struct outputs_t {
+        struct out_t {
+            int value;
+        } out;
+    } outputs;
+
+    void main(const cycle_b_t& b);
+};
+
+struct cycle_b_t : name_<"b">
+{
+    struct outputs_t {
+        struct out_t {
+            int value;
+        } out;
+    } outputs;
+
+    void main(const cycle_a_t& a) { outputs.out.value = a.outputs.out.value; }
+};
+
+void cycle_a_t::main(const cycle_b_t& b) { outputs.out.value = b.outputs.out.value; }
+
+struct cycle_components_t
+{
+    cycle_a_t a;
+    cycle_b_t b;
+};
+
+TEST_CASE("sygaldry Runtime dependency order", "[runtime][order]")
+{
+    static ordered_components_t c{};
+    constexpr auto runtime = Runtime{c};
+    using graph = Runtime<ordered_components_t>::main_graph;
+    static_assert(graph::reads(0, 2)); // the plugin user reads the consumer
+    static_assert(graph::reads(1, 3)); // the assembly user reads the producer in the sensors assembly
+    static_assert(graph::reads(2, 3)); // the consumer reads the producer
+    static_assert(not graph::reads(3, 2));
+    static_assert(graph::order == std::array<std::size_t, 4>{3, 1, 2, 0});
+    static_assert(not main_dependency_graph<decltype(component_to_runtime_tuple(std::declval<cycle_components_t&>()))>::acyclic);
+
+    runtime.init();
+    runtime.tick();
+    CHECK(c.consumer.outputs.seen.value == 1);
+    CHECK(c.plugin_user.outputs.seen.value == 1);
+    CHECK(c.assembly_user.outputs.seen.value == 1);
+}
+struct profiled_component_t : name_<"profiled">
+{
+    struct outputs_t {
+        struct count_t {
+            int value;
+        } count;
+    } outputs;
+
+    void init() {}
+    void main() { ++outputs.count.value; }
+};
+
+struct fake_profiler_t : name_<"profiler">
+{
+    unsigned long now = 0;
+    std::array<std::array<unsigned long, 4>, 2> calls{};
+    std::array<std::array<unsigned long, 4>, 2> elapsed{};
+
+    unsigned long timestamp() { return now += 2; }
+    void record(std::size_t index, runtime_subroutine subroutine, unsigned long time)
+    {
+        calls[index][static_cast<std::size_t>(subroutine)] += 1;
+        elapsed[index][static_cast<std::size_t>(subroutine)] += time;
+    }
+    void main() {}
+};
+
+struct profiled_components_t
+{
+    profiled_component_t component;
+    fake_profiler_t profiler;
+};
+
+TEST_CASE("sygaldry Runtime profiling", "[runtime][profiling]")
+{
+    static_assert(std::same_as<decltype(Runtime<scheduled_components_t>::profiler), no_runtime_hook>);
+
+    static profiled_components_t c{};
+    constexpr auto runtime = Runtime{c};
+    static_assert(&runtime.profiler.ref == &c.profiler);
+    runtime.init();
+    runtime.tick();
+    runtime.tick();
+    constexpr auto init = static_cast<std::size_t>(runtime_subroutine::init);
+    constexpr auto ext_src = static_cast<std::size_t>(runtime_subroutine::external_sources);
+    constexpr auto main = static_cast<std::size_t>(runtime_subroutine::main);
+    CHECK(c.profiler.calls[0][init] == 1);
+    CHECK(c.profiler.calls[0][main] == 2);
+    CHECK(c.profiler.calls[0][ext_src] == 0); // the component has no external sources subroutine
+    CHECK(c.profiler.calls[1][main] == 2); // the profiler is profiled too
+    CHECK(c.profiler.elapsed[0][main] == 4);
+    CHECK(c.component.outputs.count.value == 2);
+}
+struct fake_monitor_t : name_<"monitor">
+{
+    int started = 0;
+    int finished = 0;
+    int main_during_tick = 0;
+
+    void tick_started() { ++started; }
+    void tick_finished() { ++finished; }
+    void main() { main_during_tick = started - finished; }
+};
+
+struct monitored_components_t
+{
+    profiled_component_t component;
+    fake_monitor_t monitor;
+};
+
+TEST_CASE("sygaldry Runtime tick monitoring", "[runtime][profiling]")
+{
+    static_assert(std::same_as<decltype(Runtime<scheduled_components_t>::monitor), no_runtime_hook>);
+
+    static monitored_components_t c{};
+    constexpr auto runtime = Runtime{c};
+    static_assert(&runtime.monitor.ref == &c.monitor);
+    runtime.init();
+    CHECK(c.monitor.started == 0);
+    runtime.tick();
+    CHECK(c.monitor.started == 1);
+    CHECK(c.monitor.finished == 1);
+    CHECK(c.monitor.main_during_tick == 1);
+    runtime.tick(1000);
+    CHECK(c.monitor.started == 2);
+    CHECK(c.monitor.finished == 2);
+}
@@ -11,6 +11,8 @@ SPDX-License-Identifier: MIT
 #include <string_view>
 #include <string>
 #include <array>
+#include <cstdint>
+#include <type_traits>
 #include "sygah-consteval.hpp"
 #include "sygah-metadata.hpp"
 
@@ -72,6 +74,23 @@ struct range_
     /// Returns the initial value of the range
     static _consteval auto init() { return _init.value; }
 };
+/// Document the smallest absolute change in the value of an endpoint that bindings should consider significant, for all elements or for each element
+template<num_literal<float> ... _deadband>
+struct deadband_
+{
+    static_assert(sizeof...(_deadband) > 0, "deadband_: at least one threshold is required");
+    /// Returns an array with the threshold of each element, or a single threshold for all elements
+    static _consteval auto deadband() { return std::array<float, sizeof...(_deadband)>{_deadband.value...}; }
+};
+
+/// Document the smallest change in the value of an endpoint, relative to the magnitude of its last significant value, that bindings should consider significant
+template<num_literal<float> ... _relative_deadband>
+struct relative_deadband_
+{
+    static_assert(sizeof...(_relative_deadband) > 0, "relative_deadband_: at least one threshold is required");
+    /// Returns an array with the relative threshold of each element, or a single threshold for all elements
+    static _consteval auto relative_deadband() { return std::array<float, sizeof...(_relative_deadband)>{_relative_deadband.value...}; }
+};
 /*! \brief A wrapper around a value-like type
 
 \details `persistent` tries to mimick value semantics, providing constructors
@@ -122,8 +141,11 @@ Endpoints inheriting from this type should state `using
 occasional<T>::operator=` to explicitly inherit the assignment operators from
 `occasional`.
 
+The type of the `updated` flag is `bool` by default, or a \ref flag_bit
+whose storage is packed with the flags of other endpoints; see below.
+
 */
-template <typename T>
+template <typename T, typename Flag = bool>
 struct occasional
 {
     /// The underlying type
@@ -131,7 +153,7 @@ struct occasional
     /// The wrapped state
     T state;
     /// Flag indicating if the state has been changed
-    bool updated;
+    Flag updated;
 
     /// Default constructor; `state` is default initialized and `updated` is false
     constexpr occasional() noexcept : state{}, updated{false} {}
@@ -141,7 +163,7 @@ struct occasional
     \details Only changes this wrapper if the other one has been updated. `updated` flag
     reflects whether the other `occasional` has been updated.
     */
-    constexpr occasional(occasional<T>&& other)
+    constexpr occasional(occasional&& other)
     {
         if (other.updated)
         {
@@ -155,7 +177,7 @@ struct occasional
     \details Only changes this wrapper if the other one has been updated. `updated` flag
     reflects whether the other `occasional` has been updated.
     */
-    constexpr occasional(const occasional<T>& other)
+    constexpr occasional(const occasional& other)
     {
         if (other.updated)
         {
@@ -169,7 +191,7 @@ struct occasional
     \details Only changes this wrapper if the other one has been updated. `updated` flag
     reflects whether the other `occasional` has been updated.
     */
-    constexpr auto& operator=(occasional<T>&& other)
+    constexpr auto& operator=(occasional&& other)
     {
         if (other.updated)
         {
@@ -184,7 +206,7 @@ struct occasional
     \details Only changes this wrapper if the other one has been updated. `updated` flag
     reflects whether the other `occasional` has been updated.
     */
-    constexpr auto& operator=(const occasional<T>& other)
+    constexpr auto& operator=(const occasional& other)
     {
         if (other.updated)
         {
@@ -225,6 +247,61 @@ struct occasional
     constexpr void reset() noexcept {updated = false;} // maintains current state
 };
 
+/*! \brief A flag stored as one bit of a bitset owned elsewhere, e.g. by the runtime
+
+\details Until it is bound to a bit with `bind`, the state of the flag is
+stored locally. Copying a flag copies its state, not the bit it is bound to.
+*/
+struct flag_bit
+{
+    using word_t = std::uint32_t;
+    /// The capacity of the table of bound bitsets, including the unused entry 0
+    static constexpr std::size_t max_bitsets = 32;
+    /// The first word of each bitset that flags are bound to
+    static inline word_t * bitsets[max_bitsets] = {};
+
+    /// The entry of the bitset holding the flag in `bitsets`, or 0 if it is not bound
+    unsigned char bitset = 0;
+    /// The index of the flag's bit in its bitset, or the state of the flag while it is not bound
+    unsigned char bit = 0;
+
+    constexpr flag_bit() noexcept = default;
+    constexpr flag_bit(bool b) noexcept : bit{b} {}
+    constexpr flag_bit(const flag_bit& other) noexcept : bit{bool(other)} {}
+    constexpr flag_bit& operator=(const flag_bit& other) noexcept { return *this = bool(other); }
+    constexpr flag_bit& operator=(bool b) noexcept
+    {
+        if (bitset == 0) bit = b;
+        else if (b) word() |= mask();
+        else word() &= ~mask();
+        return *this;
+    }
+    constexpr operator bool() const noexcept { return bitset ? (word() & mask()) != 0 : bit != 0; }
+
+    /// Store the flag in bit `b` of the bitset at entry `e` of `bitsets` from now on, keeping its current state; entry 0 leaves it unbound
+    constexpr void bind(unsigned char e, unsigned char b) noexcept
+    {
+        bool state = *this;
+        bitset = e;
+        bit = e ? b : 0;
+        *this = state;
+    }
+
+    /// Find or add the entry of the bitset whose first word is `words`, returning 0 if the table is full
+    static unsigned char bitset_entry(word_t * words) noexcept
+    {
+        for (std::size_t e = 1; e < max_bitsets; ++e)
+        {
+            if (bitsets[e] == nullptr) bitsets[e] = words;
+            if (bitsets[e] == words) return static_cast<unsigned char>(e);
+        }
+        return 0;
+    }
+
+private:
+    word_t& word() const noexcept { return bitsets[bitset][bit / 32]; }
+    constexpr word_t mask() const noexcept { return word_t{1} << (bit % 32); }
+};
 
 /// \}
 
@@ -250,10 +327,23 @@ tag(write_only);
 boot cycles) using an appropriate platform-specific method (e.g. EEPROM)
 */
 tag(session_data);
+
+/*! \brief Packed flag tag helper
+
+\details Indicates that the `updated` flag of an endpoint with occasional
+message semantics should be a \ref flag_bit, so that the runtime can store
+it packed with the flags of the component's other endpoints. The flags of
+`button` and `array_message` are always packed.
+*/
+tag(packed_flag);
 #undef tag
 /// Apply the tag helpers classes `Tags` to an entity, especially an endpoint
 template<typename ... Tags>
 struct tagged_ : Tags... {};
+
+/// The type of the `updated` flag of an occasional endpoint helper with the given tags
+template<typename ... Tags>
+using updated_flag_t = std::conditional_t<requires {tagged_<Tags...>::packed_flag;}, flag_bit, bool>;
 /*! \brief A two-state integer endpoint with occasional message semantics
 \details Example: `button<"button state", "current state of the button", 1> button_state;`
 \tparam name_str The name of the endpoint. Required.
@@ -263,13 +353,13 @@ struct tagged_ : Tags... {};
 */
 template<string_literal name_str, string_literal desc = "", char init = 0, typename ... Tags>
 struct button
-: occasional<char>
+: occasional<char, flag_bit>
 , name_<name_str>
 , description_<desc>
 , range_<0, 1, init>
 , tagged_<Tags...>
 {
-    using occasional<char>::operator=;
+    using occasional<char, flag_bit>::operator=;
 };
 
 /*! \brief A two-state integer endpoint with persistent value semantics
@@ -313,12 +403,12 @@ struct text
 */
 template<string_literal name_str, string_literal desc = "", typename ... Tags>
 struct text_message
-: occasional<std::string>
+: occasional<std::string, updated_flag_t<Tags...>>
 , name_<name_str>
 , description_<desc>
 , tagged_<Tags...>
 {
-    using occasional<std::string>::operator=;
+    using occasional<std::string, updated_flag_t<Tags...>>::operator=;
 };
 
 /*! \brief A numeric endpoint with user customizeable range and persistent value semantics
@@ -368,13 +458,13 @@ template< string_literal name_str
         , typename ... Tags
         >
 struct slider_message
-: occasional<T>
+: occasional<T, updated_flag_t<Tags...>>
 , name_<name_str>
 , description_<desc>
 , range_<min, max, init>
 , tagged_<Tags...>
 {
-    using occasional<T>::operator=;
+    using occasional<T, updated_flag_t<Tags...>>::operator=;
 };
 
 /*! \brief A multi-dimensional numeric endpoint with user customizeable range and persistent value semantics
@@ -441,21 +531,22 @@ template< string_literal name_str
         , typename ... Tags
         >
 struct array_message
-: occasional<std::array<T, N>>
+: occasional<std::array<T, N>, flag_bit>
 , name_<name_str>
 , description_<desc>
 , range_<min, max, init>
 , tagged_<Tags...>
 {
-    using occasional<std::array<T, N>>::operator=;
+    using base = occasional<std::array<T, N>, flag_bit>;
+    using base::operator=;
     using type = T;
     constexpr const auto& operator[](std::size_t i) const noexcept
     {
-        return occasional<std::array<T,N>>::state[i];
+        return base::state[i];
     }
     constexpr auto& operator[](std::size_t i) noexcept
     {
-        return occasional<std::array<T,N>>::state[i];
+        return base::state[i];
     }
     static _consteval auto size() noexcept
     {
@@ -463,7 +554,7 @@ struct array_message
     }
     void set_updated() noexcept
     {
-        occasional<std::array<T,N>>::updated = true;
+        base::updated = true;
     }
 };
 /*! \brief A semantically value-less endpoint that signals an event
@@ -33,6 +33,18 @@ TEST_CASE("sygaldry Range", "[endpoints][bases][range]")
         REQUIRE(struct_with_init::range().init == 42.0f);
     }
 }
+struct struct_with_deadband : deadband_<0.01f> {};
+struct struct_with_deadbands : deadband_<0.01f, 0.5f, 1> {};
+struct struct_with_relative_deadband : relative_deadband_<0.1f> {};
+
+TEST_CASE("sygaldry Deadband", "[endpoints][bases][deadband]")
+{
+    REQUIRE(struct_with_deadband::deadband().size() == 1);
+    REQUIRE(struct_with_deadband::deadband()[0] == 0.01f);
+    REQUIRE(struct_with_deadbands::deadband().size() == 3);
+    REQUIRE(struct_with_deadbands::deadband()[2] == 1.0f);
+    REQUIRE(struct_with_relative_deadband::relative_deadband()[0] == 0.1f);
+}
 struct persistent_struct : persistent<int> {using persistent<int>::operator=;};
 TEST_CASE("sygaldry Persistent Value", "[endpoints][helpers][persistent]")
 {
@@ -57,6 +69,32 @@ TEST_CASE("sygaldry sygah-endpoints Occasional Value")
     static_assert(OccasionalValue<occasional_struct>);
     static_assert(ClearableFlag<occasional_struct>);
 }
+struct packed_struct : occasional<int, flag_bit> { using occasional<int, flag_bit>::operator=; };
+TEST_CASE("sygaldry sygah-endpoints Packed Flags")
+{
+    auto s = packed_struct{42};
+    CHECK(s.updated);
+    static flag_bit::word_t words[2] = {};
+    auto entry = flag_bit::bitset_entry(words);
+    REQUIRE(entry != 0);
+    CHECK(flag_bit::bitset_entry(words) == entry);
+    s.updated.bind(entry, 35);
+    CHECK(words[1] == 1 << 3);
+    s.reset();
+    CHECK(not s.updated);
+    CHECK(words[1] == 0);
+    s = 88;
+    CHECK(words[1] == 1 << 3);
+    words[1] = 0;
+    CHECK(not s.updated);
+    auto copy = s;
+    CHECK(copy.updated.bitset == 0);
+    static_assert(sizeof(flag_bit) == 2);
+    static_assert(OccasionalValue<packed_struct>);
+    static_assert(ClearableFlag<packed_struct>);
+    static_assert(PackedUpdatedFlag<packed_struct>);
+    static_assert(not PackedUpdatedFlag<occasional_struct>);
+}
 struct tag_foo {enum {foo};};
 struct tag_bar {enum {bar};};
 template<typename ... Tags>
@@ -96,9 +134,16 @@ TEST_CASE("sygaldry Basic Endpoints", "[endpoints][basic]")
     static_assert(has_name<const button<"foo">&>);
     static_assert(has_name<const toggle<"bar">&>);
     static_assert(has_name<const slider<"baz">&>);
-    static_assert(sizeof(button<"foo">) <= sizeof(std::optional<bool>));
+    static_assert(sizeof(button<"foo">) == sizeof(char) + sizeof(flag_bit));
     static_assert(sizeof(toggle<"baz">) == sizeof(bool));
     static_assert(sizeof(slider<"baz">) == sizeof(float));
+    static_assert(std::same_as<decltype(button<"foo">{}.updated), flag_bit>);
+    static_assert(std::same_as<decltype(array_message<"foo", 3>{}.updated), flag_bit>);
+    static_assert(std::same_as<decltype(slider_message<"foo">{}.updated), bool>);
+    // a packed flag fits in the padding after the value of most endpoints
+    static_assert(sizeof(array_message<"foo", 3>) == sizeof(occasional<std::array<float, 3>>));
+    static_assert(sizeof(slider_message<"foo", "", float, 0.0f, 1.0f, 0.0f, tag_packed_flag>) == sizeof(slider_message<"foo">));
+    static_assert(PackedUpdatedFlag<slider_message<"foo", "", float, 0.0f, 1.0f, 0.0f, tag_packed_flag>>);
 
     auto s1 = slider<"baz">{};
     auto s2 = slider<"baz">{0.5f};
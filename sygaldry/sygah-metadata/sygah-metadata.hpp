@@ -54,6 +54,39 @@ metadata_struct(date);
 
 #undef metadata_struct
 
+/// Document the period in microseconds with which a component should be run
+template<unsigned long us>
+struct period_
+{
+    static_assert(us > 0, "a period must be greater than zero");
+    /*! Returns the period in microseconds */
+    static _consteval auto period() {return us;}
+};
+
+/// Document the rate in Hertz with which a component should be run
+template<unsigned long hz>
+struct rate_
+{
+    static_assert(hz > 0, "a rate must be greater than zero");
+    /*! Returns the rate in Hertz */
+    static _consteval auto rate() {return hz;}
+};
+
+/// Document that a component only needs to be run when a clearable flag that it depends on is set
+struct change_driven_
+{
+    /*! Returns true */
+    static _consteval bool change_driven() {return true;}
+};
+/// Document the highest rate in Hertz with which bindings should send the value of an endpoint, or of each endpoint of a component
+template<unsigned long hz>
+struct output_rate_
+{
+    static_assert(hz > 0, "an output rate must be greater than zero");
+    /*! Returns the output rate in Hertz */
+    static _consteval auto output_rate() {return hz;}
+};
+
 /// \}
 /// \}
 }
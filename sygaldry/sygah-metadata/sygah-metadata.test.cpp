@@ -21,3 +21,18 @@ TEST_CASE("sygaldry name_", "[endpoints][bases][name_]")
 {
     REQUIRE(string_view(struct_with_name::name()) == string_view("foo"));
 }
+
+struct struct_with_period : period_<1000> {};
+struct struct_with_rate : rate_<100> {};
+struct struct_with_change_driven : change_driven_ {};
+TEST_CASE("sygaldry period_ and rate_", "[endpoints][bases][period_][rate_]")
+{
+    static_assert(struct_with_period::period() == 1000);
+    static_assert(struct_with_rate::rate() == 100);
+    static_assert(struct_with_change_driven::change_driven());
+}
+struct struct_with_output_rate : output_rate_<50> {};
+TEST_CASE("sygaldry output_rate_", "[endpoints][bases][output_rate_]")
+{
+    static_assert(struct_with_output_rate::output_rate() == 50);
+}
@@ -9,15 +9,18 @@ SPDX-License-Identifier: MIT
 */
 
 #include <stdio.h>
+#include <algorithm>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include "sygac-runtime.hpp"
+#include "sygsp-micros.hpp"
 #include "sygsa-two_wire.hpp"
 #include "syghe-pins.hpp"
 #include "sygbe-spiffs.hpp"
 #include "sygbe-wifi.hpp"
 #include "sygbp-liblo.hpp"
 #include "sygbp-cstdio_cli.hpp"
+#include "sygbp-tickless_runtime.hpp"
 
 namespace sygaldry { namespace sygbe {
 
@@ -35,8 +38,11 @@ This specialized wrapper for sygaldry::Runtime draws in standard bindings and
 components expected to be useful for all instruments based on the ESP32
 platform.
 
+\tparam InnerInstrument The components of the instrument
+\tparam tickless Whether to sleep until the next deadline or message instead of for a fixed delay
+\tparam max_wait The longest time in microseconds that the loop sleeps between ticks
 */
-template<typename InnerInstrument>
+template<typename InnerInstrument, bool tickless = false, unsigned long max_wait = 10000>
 struct ESP32Instrument
 {
     struct Instrument {
@@ -60,7 +66,13 @@ struct ESP32Instrument
 
     void app_main()
     {
-        constexpr auto runtime = Runtime{instrument};
+        constexpr auto runtime = sygbp::TicklessRuntime<Instrument, max_wait>{instrument};
+        constexpr unsigned long tick_period = runtime.runtime.tick_period;
+        constexpr unsigned long loop_period = tick_period && tick_period < max_wait
+                                            ? tick_period : max_wait;
+        constexpr TickType_t loop_delay = std::max<TickType_t>(1, pdMS_TO_TICKS(loop_period / 1000));
+        constexpr bool sub_tick = tick_period && loop_period == tick_period
+                               && loop_period < portTICK_PERIOD_MS * 1000;
         // give electrical conditions a moment to settle in
         vTaskDelay(pdMS_TO_TICKS(1000));
         printf("initializing\n");
@@ -71,7 +83,10 @@ struct ESP32Instrument
         while (true)
         {
             runtime.tick();
-            vTaskDelay(pdMS_TO_TICKS(10));
+            if constexpr (tickless) runtime.wait(std::max(1000ul, runtime.timeout(sygsp::micros())));
+            else if constexpr (sub_tick)
+                while (runtime.runtime.time_to_next_tick(sygsp::micros()) > 0) taskYIELD();
+            else vTaskDelay(loop_delay);
         }
     }
 };
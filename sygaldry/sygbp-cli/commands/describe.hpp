@@ -14,7 +14,7 @@ SPDX-License-Identifier: MIT
 #include "sygac-metadata.hpp"
 #include "sygac-endpoints.hpp"
 #include "sygbp-osc_string_constants.hpp"
-#include "sygbp-osc_match_pattern.hpp"
+#include "sygbp-osc_path_trie.hpp"
 
 namespace sygaldry { namespace sygbp {
 ///\addtogroup sygbp-cli
@@ -115,12 +115,15 @@ struct Describe
     int main(int argc, char** argv, auto& log, Components& components)
     {
         if (argc < 2) return 2;
-        for_each_node(components, [&]<typename T>(T& node, auto)
+        bool valid = osc_path_trie<Components>::for_each_match(argv[1], components, [&]<typename T>(T& node, auto)
         {
-            if constexpr (has_name<T>)
-                if (osc_match_pattern(argv[1], osc_path_v<T, Components>))
-                    describe_entity<T, Components>(log, "entity: ", node);
+            describe_entity<T, Components>(log, "entity: ", node);
         });
+        if (not valid)
+        {
+            log.println("Invalid address pattern.");
+            return 2;
+        }
         return 0;
     };
 
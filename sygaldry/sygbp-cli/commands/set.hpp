@@ -10,8 +10,9 @@ SPDX-License-Identifier: MIT
 
 #include <charconv>
 #include "sygac-endpoints.hpp"
+#include "sygac-components.hpp"
 #include "sygbp-osc_string_constants.hpp"
-#include "sygbp-osc_match_pattern.hpp"
+#include "sygbp-osc_path_trie.hpp"
 
 namespace sygaldry { namespace sygbp {
 ///\addtogroup sygbp-cli
@@ -140,10 +141,16 @@ struct Set
             log.println("usage: ", usage());
             return 2;
         }
-        for_each_endpoint(components, [&]<typename T>(T& endpoint) {
-            if (osc_match_pattern(argv[1], osc_path_v<T, Components>))
+        bool valid = osc_path_trie<Components>::for_each_match(argv[1], components, [&]<typename T, typename Tag>(T& endpoint, Tag)
+        {
+            if constexpr (node::is_endpoint<Tag>::value)
                 set_endpoint_value(log, endpoint, argc-2, argv+2);
         });
+        if (not valid)
+        {
+            log.println("Invalid address pattern.");
+            return 2;
+        }
         return 0;
     }
 
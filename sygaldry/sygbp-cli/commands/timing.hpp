@@ -0,0 +1,52 @@
+#pragma once
+/*
+Copyright 2026 Travis J. West, https://traviswest.ca, Input Devices and Music
+Interaction Laboratory (IDMIL), Centre for Interdisciplinary Research in Music
+Media and Technology (CIRMMT), McGill University, Montréal, Canada, and Univ.
+Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
+
+SPDX-License-Identifier: MIT
+*/
+
+#include <boost/pfr.hpp>
+#include "sygah-consteval.hpp"
+#include "sygac-components.hpp"
+#include "sygac-endpoints.hpp"
+#include "sygac-runtime.hpp"
+#include "sygbp-osc_string_constants.hpp"
+
+namespace sygaldry { namespace sygbp {
+///\addtogroup sygbp-cli
+///\{
+
+struct Timing
+{
+    static _consteval auto name() { return "/timing"; }
+    static _consteval auto usage() { return ""; }
+    static _consteval auto description() { return "Report the timing of the loop measured by the loop monitor"; }
+
+    template<typename Components>
+    int main(int argc, char** argv, auto& log, Components& components)
+    {
+        bool found = false;
+        for_each_component(components, [&]<typename T>(T& component)
+        {
+            if constexpr (TickMonitor<T>)
+            {
+                found = true;
+                log.println(osc_path_v<T, Components>);
+                if constexpr (has_outputs<T>)
+                boost::pfr::for_each_field(outputs_of(component), [&]<typename Y>(Y& endpoint)
+                {
+                    if constexpr (has_value<Y> && not Bang<Y>)
+                        log.println("  ", endpoint.name(), ": ", value_of(endpoint));
+                });
+            }
+        });
+        if (not found) log.println("No loop monitor found; add a sygup::LoopMonitor to the assembly to measure the timing of the loop");
+        return 0;
+    }
+};
+
+///\}
+} }
@@ -20,6 +20,7 @@ SPDX-License-Identifier: MIT
 #include "commands/list.hpp"
 #include "commands/describe.hpp"
 #include "commands/set.hpp"
+#include "commands/timing.hpp"
 
 namespace sygaldry { namespace sygbp {
 ///\addtogroup sygbp sygbp: Portable Bindings
@@ -134,6 +135,12 @@ struct CustomCli : name_<"CLI">
     {
         while(reader.ready()) process(reader.getchar(), components);
     }
+
+    /// The descriptor of the reader's input, so that a tickless runtime can wake up when input arrives
+    int wait_descriptor() requires requires (Reader& r) {{r.wait_descriptor()} -> std::convertible_to<int>;}
+    {
+        return reader.wait_descriptor();
+    }
 };
 
 struct DefaultCommands
@@ -142,6 +149,7 @@ struct DefaultCommands
     List list;
     Describe describe;
     Set set;
+    Timing timing;
 };
 
 template<typename Reader, typename Logger, typename Components>
@@ -16,6 +16,7 @@ SPDX-License-Identifier: MIT
 #include "sygup-test_logger.hpp"
 #include "sygbp-test_reader.hpp"
 #include "sygbp-cli.hpp"
+#include "sygup-loop_monitor.hpp"
 
 using std::string;
 
@@ -107,6 +108,14 @@ struct TestComponents
     Component2 cpt2;
     sygaldry::sygbp::TestComponent tc;
 };
+unsigned long cli_fake_time = 0;
+unsigned long cli_fake_clock() { return cli_fake_time; }
+
+struct MonitoredComponents
+{
+    Component1 cpt1;
+    sygaldry::sygup::LoopMonitor<1000, cli_fake_clock> monitor;
+};
 
 struct CliCommands
 {
@@ -281,4 +290,32 @@ TEST_CASE("sygaldry Set", "[bindings][cli][commands][set]")
         test_command(Set{}, components, 0, "", "/set", "/Test_Component_1/array_in", "1", "2", "3");
         REQUIRE(components.tc.inputs.array_in.value == std::array<float, 3>{1,2,3});
     }
+    SECTION("set with an invalid pattern")
+    {
+        test_command(Set{}, components, 2, "Invalid address pattern.\n", "/set", "/Test_Component_1/[slider_in", "1");
+        REQUIRE(components.tc.inputs.slider_in.value == 0);
+    }
+}
+TEST_CASE("sygaldry Timing", "[bindings][cli][commands][timing]")
+{
+    test_command(Timing{}, TestComponents{}, 0,
+                 "No loop monitor found; add a sygup::LoopMonitor to the assembly to measure the timing of the loop\n",
+                 "/timing");
+
+    auto components = MonitoredComponents{};
+    components.monitor.init();
+    components.monitor.tick_started();
+    cli_fake_time = 1250;
+    components.monitor.tick_finished();
+    components.monitor.tick_started();
+    test_command(Timing{}, components, 0,
+R"TIMING(/Loop_Monitor
+  target period: 1000
+  period: 1250
+  mean period: 1250
+  duration: 1250
+  worst duration: 1250
+  overruns: 1
+  jitter: [0 0 0 0 0 0 0 0 1 0 0 0 0 0 0 0]
+)TIMING", "/timing");
 }
@@ -43,6 +43,12 @@ struct CstdioReader
     {
         return last_read;
     }
+
+    /// The descriptor of the standard input, so that a tickless runtime can wait for input
+    /*! Once the standard input has reached its end, e.g. when it is redirected
+    from `/dev/null`, it would always be readable, so no descriptor is returned.
+    */
+    int wait_descriptor() const { return feof(stdin) ? -1 : 0; }
 };
 
 ///\}
@@ -0,0 +1,522 @@
+#pragma once
+/*
+Copyright 2026 Travis J. West, https://traviswest.ca, Input Devices and Music
+Interaction Laboratory (IDMIL), Centre for Interdisciplinary Research in Music
+Media and Technology (CIRMMT), McGill University, Montréal, Canada, and Univ.
+Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
+
+SPDX-License-Identifier: MIT
+*/
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <string>
+#include <string_view>
+#include <boost/mp11.hpp>
+#include "sygah-consteval.hpp"
+#include "sygac-metadata.hpp"
+#include "sygac-endpoints.hpp"
+#include "sygac-components.hpp"
+#include "sygbp-osc_string_constants.hpp"
+
+namespace sygaldry { namespace sygbp {
+///\addtogroup sygbp
+///\{
+///\defgroup sygbp-endpoint_registry sygbp-endpoint_registry: Endpoint Registry
+///\{
+
+/// The type of the elements of an endpoint's value, as recorded in its descriptor
+enum class endpoint_element : unsigned char
+{
+    none, bang, boolean, character, integer, unsigned_integer, floating, double_floating, string
+};
+
+/// Whether `e` is an integral type, including `bool` and `char`
+constexpr bool is_integral(endpoint_element e)
+{
+    return e == endpoint_element::boolean || e == endpoint_element::character
+        || e == endpoint_element::integer || e == endpoint_element::unsigned_integer;
+}
+
+/// Whether `e` is a floating point type
+constexpr bool is_floating_point(endpoint_element e)
+{
+    return e == endpoint_element::floating || e == endpoint_element::double_floating;
+}
+
+template<typename T>
+_consteval endpoint_element endpoint_element_of()
+{
+    if constexpr (Bang<T>) return endpoint_element::bang;
+    else if constexpr (not has_value<T>) return endpoint_element::none;
+    else
+    {
+        using E = element_t<T>;
+             if constexpr (std::same_as<E, bool>) return endpoint_element::boolean;
+        else if constexpr (std::same_as<E, char>) return endpoint_element::character;
+        else if constexpr (std::same_as<E, int>) return endpoint_element::integer;
+        else if constexpr (std::same_as<E, unsigned>) return endpoint_element::unsigned_integer;
+        else if constexpr (std::same_as<E, float>) return endpoint_element::floating;
+        else if constexpr (std::same_as<E, double>) return endpoint_element::double_floating;
+        else if constexpr (std::same_as<E, std::string>) return endpoint_element::string;
+        else return endpoint_element::none;
+    }
+}
+
+template<typename T>
+_consteval unsigned short endpoint_size_of()
+{
+    if constexpr (Bang<T> || not has_value<T>) return 0;
+    else if constexpr (array_like<value_t<T>>) return size<value_t<T>>();
+    else return 1;
+}
+
+/// A description of one endpoint of a component container of type `Components`
+template<typename Components>
+struct endpoint_descriptor
+{
+    const char * name; ///< The name of the endpoint
+    const char * path; ///< The OSC address of the endpoint
+    const char * type_string; ///< The OSC type tag string of the endpoint, starting with ','
+    endpoint_element element; ///< The type of the elements of the endpoint's value
+    unsigned short size; ///< The number of elements; 1 for scalars and 0 for bangs
+    bool array; ///< Whether the value is an array, even of size 1
+    bool input; ///< Whether the endpoint is an input, as opposed to an output
+    bool occasional; ///< Whether the endpoint has a clearable updated flag
+    bool session_data; ///< Whether the endpoint is tagged as session data
+    bool write_only; ///< Whether the endpoint is tagged as write only
+    bool ranged; ///< Whether `min`, `max` and `init` are meaningful
+    unsigned short bytes; ///< The size of a trivially copyable value in bytes, or 0
+    float min; ///< The minimum of the endpoint's range
+    float max; ///< The maximum of the endpoint's range
+    float init; ///< The initial value of the endpoint's range
+    const float * deadband; ///< The absolute deadband of each element, or null
+    const float * relative_deadband; ///< The relative deadband of each element, or null
+    unsigned long output_period; ///< The shortest period in microseconds between two messages, or 0 if there is no limit
+    unsigned short component; ///< The index of the component of the endpoint among the components of the container
+    void * (*value)(Components&); ///< The address of the endpoint's value or first element, or null
+    bool (*flag)(Components&); ///< The state of the endpoint's updated flag, or null
+    void (*set_flag)(Components&); ///< Set the endpoint's updated flag, or null
+};
+
+/// Expand the deadband `thresholds` of an endpoint of type `T` to one threshold per element
+template<typename T, std::size_t N>
+_consteval auto endpoint_thresholds(std::array<float, N> thresholds)
+{
+    constexpr auto size = endpoint_size_of<T>();
+    static_assert(N == 1 || N == size, "deadband: give either one threshold, or one per element");
+    std::array<float, size> ret{};
+    for (std::size_t i = 0; i < size; ++i) ret[i] = thresholds[N == 1 ? 0 : i];
+    return ret;
+}
+
+template<has_deadband T>
+inline constexpr auto endpoint_deadband_v = endpoint_thresholds<T>(get_deadband<T>());
+
+template<has_relative_deadband T>
+inline constexpr auto endpoint_relative_deadband_v = endpoint_thresholds<T>(get_relative_deadband<T>());
+
+/// The output period declared by the last entity in the list `Path` that declares one, or zero
+template<typename Path> struct nearest_output_period;
+
+template<template<typename...> typename L, typename ... Path>
+struct nearest_output_period<L<Path...>>
+{
+    static constexpr unsigned long value = []()
+    {
+        unsigned long ret = 0;
+        ((ret = output_period_of<Path>() ? output_period_of<Path>() : ret), ...);
+        return ret;
+    }();
+};
+
+template<typename Node>
+using is_component_node = node::is_component<typename Node::tag>;
+
+template<typename Components, typename Node>
+constexpr endpoint_descriptor<Components> make_endpoint_descriptor()
+{
+    using T = typename Node::type;
+    endpoint_descriptor<Components> ret{};
+    ret.name = name_of<T>();
+    ret.path = osc_path_v<T, Components>;
+    ret.type_string = osc_type_string_v<T>;
+    ret.element = endpoint_element_of<T>();
+    ret.size = endpoint_size_of<T>();
+    if constexpr (has_value<T>) ret.array = array_like<value_t<T>>;
+    if constexpr (has_value<T> && not Bang<T>)
+        if constexpr (std::is_trivially_copyable_v<value_t<T>>)
+            ret.bytes = sizeof(value_t<T>);
+    ret.input = std::same_as<typename Node::tag, node::input_endpoint>;
+    ret.occasional = ClearableFlag<T>;
+    ret.session_data = tagged_session_data<T>;
+    ret.write_only = tagged_write_only<T>;
+    if constexpr (has_range<T>)
+    {
+        ret.ranged = true;
+        ret.min = static_cast<float>(get_range<T>().min);
+        ret.max = static_cast<float>(get_range<T>().max);
+        ret.init = static_cast<float>(get_range<T>().init);
+    }
+    if constexpr (has_deadband<T>) ret.deadband = endpoint_deadband_v<T>.data();
+    if constexpr (has_relative_deadband<T>) ret.relative_deadband = endpoint_relative_deadband_v<T>.data();
+    ret.output_period = nearest_output_period<path_t<T, Components>>::value;
+    using components = boost::mp11::mp_copy_if<node_index_t<Components>, is_component_node>;
+    ret.component = boost::mp11::mp_find<components, typename Node::parent::parent>::value;
+    if constexpr (has_value<T> && not Bang<T>)
+        ret.value = +[](Components& components) -> void *
+        {
+            if constexpr (array_like<value_t<T>>)
+                return &value_of(Node::get(components))[0];
+            else return &value_of(Node::get(components));
+        };
+    if constexpr (ClearableFlag<T>)
+    {
+        ret.flag = +[](Components& components) { return flag_state_of(Node::get(components)); };
+        ret.set_flag = +[](Components& components) { set_flag(Node::get(components)); };
+    }
+    return ret;
+}
+
+/// Scramble the bits of `h` with the MurmurHash3 finalizer
+constexpr std::uint32_t hash_mix(std::uint32_t h)
+{
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+/// A 32 bit FNV-1a hash of `path`, finalized with `hash_mix`
+constexpr std::uint32_t path_hash(std::string_view path)
+{
+    std::uint32_t h = 2166136261u;
+    for (char c : path)
+    {
+        h ^= static_cast<unsigned char>(c);
+        h *= 16777619u;
+    }
+    return hash_mix(h);
+}
+
+/*! \brief A perfect hash table mapping `N` strings known at compile time to their index
+
+\details `operator()` returns the index of the only string that could be equal
+to its argument, or `N` if there is none; the caller is responsible for
+comparing the argument with the string at the returned index. `valid` is false
+if the table could not be built, which is vanishingly unlikely but would
+happen if two different strings had the same 32 bit hash.
+*/
+template<std::size_t N>
+struct perfect_path_hash
+{
+    static_assert(N < 0xffff, "perfect_path_hash: too many strings");
+
+    /// The number of slots and buckets, each a power of two
+    static constexpr std::size_t table_size = std::bit_ceil(N == 0 ? std::size_t(1) : N);
+
+    std::array<std::uint16_t, table_size> seed{};
+    std::array<std::uint16_t, table_size> slot{};
+    bool valid = true;
+
+    static constexpr std::size_t bucket_of(std::uint32_t h)
+    {
+        return h & (table_size - 1);
+    }
+
+    static constexpr std::size_t slot_of(std::uint32_t h, std::uint32_t seed)
+    {
+        return hash_mix(h ^ (seed * 0x9e3779b9u)) & (table_size - 1);
+    }
+
+    constexpr perfect_path_hash(const std::array<std::string_view, N>& strings)
+    {
+        slot.fill(N);
+
+        // group the hashes of the unique strings by bucket
+        std::array<std::uint32_t, N> hash{};
+        std::array<std::size_t, table_size> count{};
+        std::array<bool, N> duplicate{};
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            hash[i] = path_hash(strings[i]);
+            for (std::size_t j = 0; j < i && not duplicate[i]; ++j)
+                duplicate[i] = hash[j] == hash[i] && strings[j] == strings[i];
+            if (not duplicate[i]) ++count[bucket_of(hash[i])];
+        }
+        std::array<std::size_t, table_size + 1> start{};
+        for (std::size_t b = 0; b < table_size; ++b) start[b + 1] = start[b] + count[b];
+        std::array<std::size_t, N> member{};
+        std::array<std::size_t, table_size> filled{};
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            if (duplicate[i]) continue;
+            auto b = bucket_of(hash[i]);
+            member[start[b] + filled[b]++] = i;
+        }
+
+        // place the largest buckets first, while the table is mostly empty
+        std::array<std::size_t, table_size> order{};
+        for (std::size_t b = 0; b < table_size; ++b) order[b] = b;
+        std::sort(order.begin(), order.end(), [&](auto a, auto b) { return count[a] > count[b]; });
+
+        std::array<std::size_t, N> tentative{};
+        for (auto b : order)
+        {
+            if (count[b] == 0) break;
+            bool placed = false;
+            for (std::uint32_t s = 1; s < 0xffff && not placed; ++s)
+            {
+                placed = true;
+                for (std::size_t m = 0; m < count[b] && placed; ++m)
+                {
+                    auto x = slot_of(hash[member[start[b] + m]], s);
+                    placed = slot[x] == N;
+                    for (std::size_t n = 0; n < m && placed; ++n) placed = tentative[n] != x;
+                    tentative[m] = x;
+                }
+                if (not placed) continue;
+                seed[b] = static_cast<std::uint16_t>(s);
+                for (std::size_t m = 0; m < count[b]; ++m)
+                    slot[tentative[m]] = static_cast<std::uint16_t>(member[start[b] + m]);
+            }
+            if (not placed)
+            {
+                valid = false;
+                return;
+            }
+        }
+    }
+
+    /// The index of the only string that could be equal to `path`, or `N`
+    constexpr std::size_t operator()(std::string_view path) const
+    {
+        auto h = path_hash(path);
+        return slot[slot_of(h, seed[bucket_of(h)])];
+    }
+};
+
+/*! \brief A `constexpr` table of descriptors of every endpoint in a component container of type `Components`
+
+\details The index of an endpoint's descriptor in `endpoints` identifies the
+endpoint. Use `index_of` to get the index of an endpoint type at compile time,
+and `find` to look up an endpoint by its OSC address at runtime in constant
+time.
+*/
+template<typename Components>
+struct endpoint_registry
+{
+    using descriptor = endpoint_descriptor<Components>;
+
+    template<typename Node>
+    using is_endpoint_node = node::is_endpoint<typename Node::tag>;
+
+    /// The entries of the endpoints in the node index of the container
+    using nodes = boost::mp11::mp_copy_if<node_index_t<Components>, is_endpoint_node>;
+
+    /// The number of endpoints in the container
+    static constexpr std::size_t size = boost::mp11::mp_size<nodes>::value;
+
+    /// Returned by `find` when no endpoint matches
+    static constexpr std::size_t npos = size;
+
+    /// The descriptors of the endpoints in the container, in tree order
+    static constexpr std::array<descriptor, size> endpoints = []<typename ... Nodes>(boost::mp11::mp_list<Nodes...>)
+    {
+        return std::array<descriptor, size>{make_endpoint_descriptor<Components, Nodes>()...};
+    }(nodes{});
+
+    /// The index of the descriptor of the endpoint of type `T`
+    template<typename T>
+    static constexpr std::size_t index_of = boost::mp11::mp_find_if_q<nodes, indexed_type_is<T>>::value;
+
+    /// A perfect hash of the OSC addresses of the endpoints
+    static constexpr perfect_path_hash<size> path_hash = []()
+    {
+        std::array<std::string_view, size> paths{};
+        for (std::size_t i = 0; i < size; ++i) paths[i] = endpoints[i].path;
+        return paths;
+    }();
+    static_assert(path_hash.valid, "endpoint_registry: unable to build a perfect hash of the endpoint addresses");
+
+    /// The index of the endpoint with the OSC address `path`, or `npos` if there is none
+    static constexpr std::size_t find(std::string_view path)
+    {
+        auto i = path_hash(path);
+        if (i < size && path == endpoints[i].path) return i;
+        return npos;
+    }
+};
+
+/*! \brief Call `f` with a reference to element `i` of the value at `value`, whose elements are of type `e`
+
+\details `value` is usually the result of an endpoint descriptor's `value`
+thunk. `f` is not called if `e` is `none` or `bang`.
+*/
+template<typename F>
+void visit_element(endpoint_element e, void * value, std::size_t i, F&& f)
+{
+    switch (e)
+    {
+    case endpoint_element::boolean: f(static_cast<bool *>(value)[i]); return;
+    case endpoint_element::character: f(static_cast<char *>(value)[i]); return;
+    case endpoint_element::integer: f(static_cast<int *>(value)[i]); return;
+    case endpoint_element::unsigned_integer: f(static_cast<unsigned *>(value)[i]); return;
+    case endpoint_element::floating: f(static_cast<float *>(value)[i]); return;
+    case endpoint_element::double_floating: f(static_cast<double *>(value)[i]); return;
+    case endpoint_element::string: f(static_cast<std::string *>(value)[i]); return;
+    default: return;
+    }
+}
+
+/// Whether the change from `last` to `current` of element `i` is within its absolute or relative deadband, either of which may be null
+constexpr bool within_deadband(const float * deadband, const float * relative_deadband, std::size_t i, double current, double last)
+{
+    double threshold = 0;
+    if (deadband) threshold = deadband[i];
+    if (relative_deadband) threshold = std::max(threshold, relative_deadband[i] * (last < 0 ? -last : last));
+    double difference = current < last ? last - current : current - last;
+    return difference <= threshold;
+}
+
+/// A copy of the last value of each persistent output endpoint of a component container, used to detect changes
+template<typename Components>
+struct endpoint_value_cache
+{
+    using registry = endpoint_registry<Components>;
+
+    static constexpr bool cached(const endpoint_descriptor<Components>& d)
+    {
+        return not d.input && not d.occasional && d.value != nullptr;
+    }
+
+    struct layout_t
+    {
+        std::array<unsigned short, registry::size> offset;
+        std::size_t bytes;
+        std::size_t strings;
+    };
+
+    /// Where each endpoint is stored in `bytes` or `strings`, and their sizes
+    static constexpr layout_t layout = []()
+    {
+        layout_t ret{};
+        for (std::size_t i = 0; i < registry::size; ++i)
+        {
+            const auto& d = registry::endpoints[i];
+            if (not cached(d)) continue;
+            if (d.element == endpoint_element::string)
+            {
+                ret.offset[i] = static_cast<unsigned short>(ret.strings);
+                ret.strings += d.size;
+            }
+            else
+            {
+                ret.offset[i] = static_cast<unsigned short>(ret.bytes);
+                ret.bytes += d.bytes;
+            }
+        }
+        return ret;
+    }();
+
+    std::array<unsigned char, layout.bytes> bytes{};
+    std::array<std::string, layout.strings> strings{};
+
+    /*! \brief Whether the endpoint at index `i` of the registry should be considered changed
+
+    \details For cached endpoints, the cache is updated with the current value
+    if it has changed. Inputs and endpoints without a value or flag are never
+    considered changed.
+    */
+    bool changed(std::size_t i, Components& components)
+    {
+        const auto& d = registry::endpoints[i];
+        if (d.flag) return d.flag(components);
+        if (not cached(d)) return false;
+        void * value = d.value(components);
+        if (d.element == endpoint_element::string)
+        {
+            auto * current = static_cast<std::string *>(value);
+            auto * last = &strings[layout.offset[i]];
+            if (std::equal(current, current + d.size, last)) return false;
+            std::copy(current, current + d.size, last);
+            return true;
+        }
+        unsigned char * last = bytes.data() + layout.offset[i];
+        if (std::memcmp(last, value, d.bytes) == 0) return false;
+        if ((d.deadband || d.relative_deadband) && within_deadband(d, last, value)) return false;
+        std::memcpy(last, value, d.bytes);
+        return true;
+    }
+
+    /// Whether every element of `value` is within the deadband of the corresponding element of `last`
+    static bool within_deadband(const endpoint_descriptor<Components>& d, const unsigned char * last, void * value)
+    {
+        bool within = true;
+        for (std::size_t j = 0; j < d.size && within; ++j)
+            visit_element(d.element, value, j, [&]<typename E>(const E& current)
+            {
+                if constexpr (std::is_arithmetic_v<E>)
+                {
+                    E previous;
+                    std::memcpy(&previous, last + j * sizeof(E), sizeof(E));
+                    within = sygbp::within_deadband(d.deadband, d.relative_deadband, j
+                            , static_cast<double>(current), static_cast<double>(previous));
+                }
+            });
+        return within;
+    }
+};
+
+/// Tracks when each output endpoint of a component container was last sent, to limit the rate of their messages
+template<typename Components>
+struct endpoint_rate_limiter
+{
+    using registry = endpoint_registry<Components>;
+
+    struct state_t
+    {
+        unsigned long last; ///< The time the endpoint was last sent
+        bool sent; ///< Whether the endpoint has been sent at all
+        bool pending; ///< Whether the endpoint has changed since it was last sent
+    };
+
+    std::array<state_t, registry::size> state{};
+
+    /// The number of changes that were replaced by a newer value before they could be sent
+    unsigned long suppressed = 0;
+
+    /*! \brief Whether the endpoint at index `i` of the registry should be sent at time `now`
+
+    \details `changed` is whether the endpoint changed since the last call,
+    e.g. as reported by an `endpoint_value_cache`. `period` is the output
+    period in microseconds of endpoints that don't declare one, or zero if
+    they are not limited. Times are in microseconds, and may wrap around.
+    */
+    bool due(std::size_t i, bool changed, unsigned long now, unsigned long period = 0)
+    {
+        const auto& d = registry::endpoints[i];
+        if (d.flag) return changed;
+        auto& s = state[i];
+        if (changed && s.pending) ++suppressed;
+        s.pending = s.pending || changed;
+        if (not s.pending) return false;
+        if (d.output_period) period = d.output_period;
+        if (period && s.sent && now - s.last < period) return false;
+        s.pending = false;
+        s.sent = true;
+        s.last = now;
+        return true;
+    }
+};
+
+///\}
+///\}
+} }
@@ -0,0 +1,266 @@
+/*
+Copyright 2026 Travis J. West, https://traviswest.ca, Input Devices and Music
+Interaction Laboratory (IDMIL), Centre for Interdisciplinary Research in Music
+Media and Technology (CIRMMT), McGill University, Montréal, Canada, and Univ.
+Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
+
+SPDX-License-Identifier: MIT
+*/
+
+#include <limits>
+#include <string>
+#include <string_view>
+#include <catch2/catch_test_macros.hpp>
+#include "sygah-endpoints.hpp"
+#include "sygbp-test_component.hpp"
+#include "sygbp-endpoint_registry.hpp"
+
+using std::string;
+using std::string_view;
+using namespace sygaldry;
+using namespace sygaldry::sygbp;
+
+struct registry_test_components
+{
+    TestComponent tc;
+};
+
+using registry = endpoint_registry<registry_test_components>;
+static_assert(registry::size == 14);
+
+// endpoints are in tree order
+static_assert(registry::endpoints[0].input);
+static_assert(not registry::endpoints[7].input);
+static_assert(string_view(registry::endpoints[2].path) == string_view("/Test_Component_1/slider_in"));
+static_assert(string_view(registry::endpoints[2].type_string) == string_view(",f"));
+static_assert(registry::endpoints[2].ranged);
+static_assert(registry::endpoints[2].max == 1.0f);
+static_assert(registry::endpoints[2].element == endpoint_element::floating);
+
+// indices and lookup
+static_assert(registry::index_of<decltype(TestComponent::outputs_t::array_out)> == 13);
+static_assert(registry::find("/Test_Component_1/text_in") == 4);
+static_assert(registry::find("/Test_Component_1/nonexistent") == registry::npos);
+static_assert([]()
+{
+    for (std::size_t i = 0; i < registry::size; ++i)
+        if (registry::find(registry::endpoints[i].path) != i) return false;
+    return true;
+}());
+
+// duplicate addresses resolve to their first occurrence
+struct duplicate_test_components
+{
+    TestComponent tc1;
+    TestComponent tc2;
+};
+using duplicate_registry = endpoint_registry<duplicate_test_components>;
+static_assert(duplicate_registry::find("/Test_Component_1/text_in") == 4);
+static_assert(perfect_path_hash<0>{{}}("/anything") == 0);
+
+// value types
+static_assert(registry::endpoints[0].element == endpoint_element::character);
+static_assert(registry::endpoints[0].occasional);
+static_assert(registry::endpoints[3].element == endpoint_element::bang);
+static_assert(registry::endpoints[3].size == 0);
+static_assert(registry::endpoints[3].value == nullptr);
+static_assert(registry::endpoints[4].element == endpoint_element::string);
+static_assert(not registry::endpoints[4].occasional);
+static_assert(registry::endpoints[4].flag == nullptr);
+static_assert(registry::endpoints[6].array);
+static_assert(registry::endpoints[6].size == 3);
+
+TEST_CASE("sygaldry endpoint registry runtime lookup")
+{
+    string path = "/Test_Component_1/slider_out";
+    REQUIRE(registry::find(path) == registry::index_of<decltype(TestComponent::outputs_t::slider_out)>);
+    path.back() = 'x';
+    REQUIRE(registry::find(path) == registry::npos);
+    REQUIRE(registry::find("") == registry::npos);
+}
+
+TEST_CASE("sygaldry endpoint registry thunks")
+{
+    registry_test_components components{};
+    auto& slider = registry::endpoints[registry::find("/Test_Component_1/slider_in")];
+    *static_cast<float *>(slider.value(components)) = 0.5f;
+    REQUIRE(components.tc.inputs.slider_in.value == 0.5f);
+
+    auto& array = registry::endpoints[registry::index_of<decltype(TestComponent::inputs_t::array_in)>];
+    static_cast<float *>(array.value(components))[2] = 0.25f;
+    REQUIRE(components.tc.inputs.array_in.value[2] == 0.25f);
+
+    auto& text = registry::endpoints[registry::find("/Test_Component_1/text_message_in")];
+    REQUIRE(not text.flag(components));
+    *static_cast<std::string *>(text.value(components)) = "hello";
+    text.set_flag(components);
+    REQUIRE(text.flag(components));
+    REQUIRE(components.tc.inputs.text_msg_in.value() == "hello");
+}
+
+static_assert(registry::endpoints[2].bytes == sizeof(float));
+static_assert(registry::endpoints[6].bytes == 3 * sizeof(float));
+static_assert(registry::endpoints[4].bytes == 0);
+
+TEST_CASE("sygaldry endpoint registry type-erased visitation")
+{
+    registry_test_components components{};
+    components.tc.inputs.array_in = {1.0f, 2.0f, 3.0f};
+    auto& array = registry::endpoints[registry::index_of<decltype(TestComponent::inputs_t::array_in)>];
+    float sum = 0;
+    for (std::size_t i = 0; i < array.size; ++i)
+        visit_element(array.element, array.value(components), i, [&](auto& x)
+        {
+            if constexpr (std::is_arithmetic_v<std::remove_cvref_t<decltype(x)>>) sum += x;
+        });
+    REQUIRE(sum == 6.0f);
+
+    auto& text = registry::endpoints[registry::find("/Test_Component_1/text_in")];
+    visit_element(text.element, text.value(components), 0, [](auto& x)
+    {
+        if constexpr (std::same_as<std::remove_cvref_t<decltype(x)>, std::string>) x = "visited";
+    });
+    REQUIRE(components.tc.inputs.text_in.value == "visited");
+}
+
+TEST_CASE("sygaldry endpoint value cache")
+{
+    registry_test_components components{};
+    endpoint_value_cache<registry_test_components> cache{};
+    constexpr auto slider = registry::find("/Test_Component_1/slider_out");
+    constexpr auto text = registry::find("/Test_Component_1/text_out");
+    constexpr auto button = registry::find("/Test_Component_1/button_out");
+    constexpr auto slider_in = registry::find("/Test_Component_1/slider_in");
+
+    // default values are not changes
+    REQUIRE(not cache.changed(slider, components));
+    REQUIRE(not cache.changed(text, components));
+
+    components.tc.outputs.slider_out = 0.5f;
+    components.tc.outputs.text_out = std::string("changed");
+    REQUIRE(cache.changed(slider, components));
+    REQUIRE(cache.changed(text, components));
+    REQUIRE(not cache.changed(slider, components));
+    REQUIRE(not cache.changed(text, components));
+
+    // occasional values follow their flag
+    REQUIRE(not cache.changed(button, components));
+    components.tc.outputs.button_out = 1;
+    REQUIRE(cache.changed(button, components));
+
+    // inputs are not cached
+    components.tc.inputs.slider_in = 0.5f;
+    REQUIRE(not cache.changed(slider_in, components));
+}
+
+struct deadband_test_component : name_<"Deadband Test"> {
+    struct inputs_t {} inputs;
+    struct outputs_t {
+        slider<"absolute", "", float, -1.0f, 1.0f, 0.0f, deadband_<0.1f>> absolute;
+        slider<"relative", "", float, -100.0f, 100.0f, 0.0f, relative_deadband_<0.5f>> relative;
+        array<"elements", 2, "", int, 0, 100, 0, deadband_<1, 10>> elements;
+    } outputs;
+};
+struct deadband_test_components
+{
+    deadband_test_component dt;
+};
+using deadband_registry = endpoint_registry<deadband_test_components>;
+static_assert(deadband_registry::endpoints[0].deadband[0] == 0.1f);
+static_assert(deadband_registry::endpoints[0].relative_deadband == nullptr);
+static_assert(deadband_registry::endpoints[1].relative_deadband[0] == 0.5f);
+static_assert(deadband_registry::endpoints[2].deadband[1] == 10.0f);
+static_assert(registry::endpoints[2].deadband == nullptr);
+static_assert(within_deadband(nullptr, nullptr, 0, 1.0, 1.0));
+static_assert(not within_deadband(nullptr, nullptr, 0, 1.0, 2.0));
+
+TEST_CASE("sygaldry endpoint value cache deadbands")
+{
+    deadband_test_components components{};
+    auto& out = components.dt.outputs;
+    endpoint_value_cache<deadband_test_components> cache{};
+
+    // changes within the absolute deadband are ignored, but accumulate
+    out.absolute = 0.05f;
+    REQUIRE(not cache.changed(0, components));
+    out.absolute = 0.15f;
+    REQUIRE(cache.changed(0, components));
+    out.absolute = 0.2f;
+    REQUIRE(not cache.changed(0, components));
+    out.absolute = std::numeric_limits<float>::quiet_NaN();
+    REQUIRE(cache.changed(0, components));
+
+    // the relative deadband scales with the last reported value
+    out.relative = 10.0f;
+    REQUIRE(cache.changed(1, components));
+    out.relative = 14.0f;
+    REQUIRE(not cache.changed(1, components));
+    out.relative = 16.0f;
+    REQUIRE(cache.changed(1, components));
+
+    // each element has its own threshold, and any element can cause a change
+    out.elements = std::array<int, 2>{1, 10};
+    REQUIRE(not cache.changed(2, components));
+    out.elements = std::array<int, 2>{1, 11};
+    REQUIRE(cache.changed(2, components));
+    out.elements = std::array<int, 2>{2, 11};
+    REQUIRE(not cache.changed(2, components));
+    out.elements = std::array<int, 2>{3, 11};
+    REQUIRE(cache.changed(2, components));
+}
+
+struct rate_test_component : name_<"Rate Test">, output_rate_<100> {
+    struct inputs_t {} inputs;
+    struct outputs_t {
+        slider<"component rate"> component_rate;
+        slider<"fast", "", float, 0.0f, 1.0f, 0.0f, output_rate_<1000>> fast;
+        button<"button"> event;
+    } outputs;
+};
+struct rate_test_components
+{
+    rate_test_component rt;
+    TestComponent tc;
+};
+using rate_registry = endpoint_registry<rate_test_components>;
+static_assert(rate_registry::endpoints[0].output_period == 10000);
+static_assert(rate_registry::endpoints[1].output_period == 1000);
+static_assert(rate_registry::endpoints[2].output_period == 10000);
+static_assert(rate_registry::endpoints[3].output_period == 0);
+
+// endpoints record their component
+static_assert(rate_registry::endpoints[2].component == 0);
+static_assert(rate_registry::endpoints[3].component == 1);
+static_assert(duplicate_registry::endpoints[registry::size].component == 1);
+
+TEST_CASE("sygaldry endpoint rate limiter")
+{
+    endpoint_rate_limiter<rate_test_components> limiter{};
+    constexpr auto slider_out = rate_registry::find("/Test_Component_1/slider_out");
+
+    // the first change is sent immediately, later ones once per period
+    REQUIRE(limiter.due(0, true, 5000));
+    REQUIRE(not limiter.due(0, true, 10000));
+    REQUIRE(not limiter.due(0, true, 12000));
+    REQUIRE(not limiter.due(0, false, 14000));
+    REQUIRE(limiter.due(0, false, 15000));
+    REQUIRE(limiter.suppressed == 1);
+    REQUIRE(not limiter.due(0, false, 40000));
+    REQUIRE(limiter.due(0, true, 40000));
+
+    // endpoints without metadata use the given period, if any
+    REQUIRE(limiter.due(slider_out, true, 0));
+    REQUIRE(limiter.due(slider_out, true, 1));
+    REQUIRE(not limiter.due(slider_out, true, 2, 1000));
+    REQUIRE(limiter.due(slider_out, false, 1001, 1000));
+
+    // events are never held back
+    REQUIRE(limiter.due(2, true, 40001));
+    REQUIRE(limiter.due(2, true, 40002));
+    REQUIRE(not limiter.due(2, false, 40003));
+
+    // timestamps may wrap around
+    REQUIRE(limiter.due(1, true, static_cast<unsigned long>(-500)));
+    REQUIRE(not limiter.due(1, true, 0));
+    REQUIRE(limiter.due(1, false, 500));
+}
@@ -9,14 +9,30 @@ SPDX-License-Identifier: LGPL-2.1-or-later
 */
 
 #include <stdio.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <thread>
 #include <lo/lo.h>
 #include <lo/lo_lowlevel.h>
 #include <lo/lo_types.h>
+#include <netdb.h>
+#include <sys/socket.h>
 #include "sygac-metadata.hpp"
 #include "sygac-endpoints.hpp"
 #include "sygah-endpoints.hpp"
 #include "sygbp-osc_string_constants.hpp"
+#include "sygbp-endpoint_registry.hpp"
+#include "sygbp-osc_match_pattern.hpp"
+#include "sygbp-osc_frame.hpp"
+#include "sygbp-osc_packet.hpp"
+#include "sygbp-osc_clock.hpp"
+#include "sygbp-spsc_queue.hpp"
+#include "sygsp-micros.hpp"
 
 namespace sygaldry { namespace sygbp {
 ///\addtogroup sygbp
@@ -24,7 +40,7 @@ namespace sygaldry { namespace sygbp {
 ///\defgroup sygbp-liblo sygbp-liblo: Liblo OSC Binding
 ///\{
 
-template<typename Components>
+template<typename Components, unsigned long (*clock)() = sygsp::micros>
 struct LibloOsc
 : name_<"Liblo OSC">
 , author_<"Travis J. West">
@@ -46,15 +62,289 @@ struct LibloOsc
                     , "The IP address to send outgoing messages to."
                     , tag_session_data
                     > dst_addr;
+        slider< "input budget"
+              , "The largest number of messages received per tick; 0 for the default of 64."
+              , int, 0, 1000, 0
+              , tag_session_data
+              > input_budget;
+        slider< "input time budget"
+              , "The longest time in microseconds spent receiving messages per tick; 0 for no limit."
+              , int, 0, 1000000, 0
+              , tag_session_data
+              > input_time_budget;
+        slider< "bundle size"
+              , "The largest size in bytes of each bundle of output messages; 0 for the default of 1472, which fits in one Ethernet or WiFi frame."
+              , int, 0, 65507, 0
+              , tag_session_data
+              > bundle_size;
+        slider< "output rate"
+              , "The highest rate in Hertz at which each continuous output without its own output rate is sent; 0 for no limit."
+              , int, 0, 1000, 0
+              , tag_session_data
+              > output_rate;
+        toggle< "frame output"
+              , "Send the continuous outputs as a single OSC message with a fixed layout."
+              , 0
+              , tag_session_data
+              > frame_output;
+        toggle< "receive thread"
+              , "Receive messages on a dedicated thread, and apply them to the inputs on each tick."
+              , 0
+              , tag_session_data
+              > receive_thread;
+        toggle< "timestamp bundles"
+              , "Stamp output bundles with the time of the tick that produced them, rather than for immediate dispatch."
+              , 0
+              , tag_session_data
+              > timestamp_bundles;
+        slider< "clock sync interval"
+              , "The number of seconds between clock synchronization requests sent to the destination; 0 to disable synchronization."
+              , int, 0, 3600, 0
+              , tag_session_data
+              > clock_sync_interval;
     } inputs;
 
     struct outputs_t {
         toggle<"server running"> server_running;
         toggle<"output running"> output_running;
+        slider<"input queue depth", "The number of messages received in the last tick.", int, 0, 1000> input_queue_depth;
+        toggle<"input backlog", "Whether messages were left waiting when the input budget of the last tick ran out."> input_backlog;
+        slider<"coalesced inputs", "The number of messages overwritten by another message to the same input in the same tick.", int, 0, 1000000> coalesced_inputs;
+        slider<"dropped inputs", "The number of messages that addressed no input endpoint or had the wrong type.", int, 0, 1000000> dropped_inputs;
+        slider< "suppressed outputs"
+              , "The number of output values replaced by a newer value before the rate limit allowed them to be sent."
+              , int, 0, 1000000
+              > suppressed_outputs;
+        slider< "clock delay"
+              , "The round trip delay in microseconds of the clock synchronization exchange used to stamp bundles."
+              , int, 0, 1000000
+              > clock_delay;
     } outputs;
 
     lo_server server{};
     lo_address dst{};
+    Components * input_components = nullptr;
+    static constexpr int default_input_budget = 64;
+    std::array<bool, endpoint_registry<Components>::size> received{};
+    std::atomic<int> dropped{0};
+    endpoint_value_cache<Components> cache{};
+    static constexpr std::size_t default_bundle_size = 1472;
+    static constexpr std::size_t bundle_header_size = 16;
+
+    /// The largest number of output messages of any one component
+    static constexpr std::size_t max_group_size = []()
+    {
+        using registry = endpoint_registry<Components>;
+        std::size_t ret = 0, count = 0;
+        for (std::size_t i = 0; i < registry::size; ++i)
+        {
+            if (i == 0 || registry::endpoints[i].component != registry::endpoints[i-1].component) count = 0;
+            if (not registry::endpoints[i].input) ret = std::max(ret, ++count);
+        }
+        return ret;
+    }();
+
+    struct staged_message
+    {
+        const char * path;
+        lo_message message;
+        std::size_t size;
+    };
+
+    std::array<staged_message, max_group_size> group{};
+    std::size_t group_count = 0;
+    std::size_t group_length = 0;
+    unsigned short group_component = 0;
+    lo_bundle bundle = nullptr;
+    std::size_t bundle_length = 0;
+    endpoint_rate_limiter<Components> limiter{};
+    using frame_t = osc_frame<Components>;
+    frame_t frame{};
+    bool frame_running = false;
+    sockaddr_storage dst_sockaddr{};
+    socklen_t dst_socklen = 0;
+    static constexpr std::size_t input_string_capacity = 64;
+    static constexpr std::size_t input_queue_capacity = 64;
+    static constexpr int receive_timeout_ms = 10;
+
+    /// The largest size of the encoded arguments of a message to an input endpoint
+    static constexpr std::size_t input_record_size = []()
+    {
+        using registry = endpoint_registry<Components>;
+        std::size_t ret = 0;
+        for (const auto& endpoint : registry::endpoints)
+        {
+            if (not endpoint.input) continue;
+            std::size_t element_size = endpoint.element == endpoint_element::string ? input_string_capacity : 4;
+            ret = std::max(ret, endpoint.size * element_size);
+        }
+        return ret;
+    }();
+
+    struct input_record
+    {
+        unsigned short endpoint;
+        unsigned short length;
+        std::array<char, input_record_size> arguments;
+    };
+
+    struct receiver_t
+    {
+        spsc_queue<input_record, input_queue_capacity> queue{};
+        std::atomic<bool> running{true};
+        std::thread thread{};
+        ~receiver_t()
+        {
+            running = false;
+            if (thread.joinable()) thread.join();
+        }
+    };
+
+    /// The receive thread and its queue, or null if messages are received on the runtime thread
+    std::unique_ptr<receiver_t> receiver;
+    osc_clock<unsigned long> wall_clock{};
+    spsc_queue<std::uint64_t, 4> tick_stamps{};
+
+    static std::uint64_t from_timetag(lo_timetag t)
+    {
+        return (static_cast<std::uint64_t>(t.sec) << 32) | t.frac;
+    }
+
+    static lo_timetag to_timetag(std::uint64_t t)
+    {
+        return lo_timetag{static_cast<std::uint32_t>(t >> 32), static_cast<std::uint32_t>(t)};
+    }
+    unsigned long last_clock_request = 0;
+    bool clock_requested = false;
+    struct clock_reply
+    {
+        std::uint64_t origin;
+        std::uint64_t receive;
+        std::uint64_t transmit;
+        unsigned long destination;
+    };
+    spsc_queue<clock_reply, 4> clock_replies{};
+
+    static int dispatch( const char *path, const char *types
+                       , lo_arg **argv, int argc, lo_message msg
+                       , void *user_data
+                       )
+    {
+        using registry = endpoint_registry<Components>;
+        auto& osc = *(LibloOsc*)user_data;
+        auto& components = *osc.input_components;
+        #ifndef NDEBUG
+            fprintf(stdout, "liblo: got message %s", path);
+            lo_message_pp(msg);
+        #endif
+        if (osc.intercept_clock_reply(path, types, argv)) return 0;
+        bool routed = false;
+        auto i = registry::find(path);
+        if (i != registry::npos)
+            routed = osc.dispatch_input(i, path, types, argv, argc, msg, components);
+        else if (std::strpbrk(path, "*?[{"))
+        {
+            osc_compiled_pattern pattern;
+            if (osc_compile_pattern(path, pattern))
+                for (i = 0; i < registry::size; ++i)
+                    if (osc_match_pattern(pattern, registry::endpoints[i].path))
+                        routed = osc.dispatch_input(i, path, types, argv, argc, msg, components) || routed;
+        }
+        if (not routed) osc.dropped.fetch_add(1, std::memory_order_relaxed);
+        return 0;
+    }
+    using input_handler = void (*)( const char *, const char *
+                                  , lo_arg **, int, lo_message
+                                  , Components&
+                                  );
+
+    template<typename Node>
+    static constexpr input_handler make_input_handler()
+    {
+        if constexpr (std::same_as<typename Node::tag, node::input_endpoint>)
+            return +[]( const char *path, const char *types
+                      , lo_arg **argv, int argc, lo_message msg
+                      , Components& components
+                      )
+            {
+                LibloOsc::set_input(path, types, argv, argc, msg, Node::get(components));
+            };
+        else return nullptr;
+    }
+
+    bool dispatch_input( std::size_t i, const char *path, const char *types
+                       , lo_arg **argv, int argc, lo_message msg
+                       , Components& components
+                       )
+    {
+        using registry = endpoint_registry<Components>;
+        static constexpr auto handlers = []<typename ... Nodes>(boost::mp11::mp_list<Nodes...>)
+        {
+            return std::array<input_handler, registry::size>{make_input_handler<Nodes>()...};
+        }(typename registry::nodes{});
+
+        const auto& endpoint = registry::endpoints[i];
+        if (not endpoint.input) return false;
+        const char * expected = endpoint.type_string + 1;
+        std::array<lo_arg, max_input_arguments> coerced;
+        std::array<lo_arg *, max_input_arguments> coerced_argv;
+        if (std::strcmp(types, expected) != 0)
+        {
+            if (not coerce_arguments(expected, types, argv, coerced, coerced_argv))
+            {
+                fprintf(stderr, "liblo: wrong type; expected '%s', got '%s'\n", expected, types);
+                return false;
+            }
+            types = expected;
+            argv = coerced_argv.data();
+        }
+        if (receiver) return enqueue_input(i, types, argv);
+        handlers[i](path, types, argv, argc, msg, components);
+        note_received(i);
+        return true;
+    }
+
+    /// The largest number of arguments of any input endpoint
+    static constexpr std::size_t max_input_arguments = []()
+    {
+        std::size_t ret = 0;
+        for (const auto& endpoint : endpoint_registry<Components>::endpoints)
+            if (endpoint.input) ret = std::max<std::size_t>(ret, endpoint.size);
+        return ret;
+    }();
+
+    /// Convert the numeric arguments in `argv` whose type differs from the `expected` type tag string, returning false if they can't all be converted
+    static bool coerce_arguments( const char * expected, const char * types, lo_arg ** argv
+                                , std::array<lo_arg, max_input_arguments>& coerced
+                                , std::array<lo_arg *, max_input_arguments>& coerced_argv
+                                )
+    {
+        std::size_t n = 0;
+        for (; expected[n] && types[n]; ++n)
+        {
+            if (n >= max_input_arguments) return false;
+            coerced_argv[n] = argv[n];
+            if (types[n] == expected[n]) continue;
+            lo_type to = static_cast<lo_type>(expected[n]);
+            lo_type from = static_cast<lo_type>(types[n]);
+            if (not lo_is_numerical_type(to) || not lo_is_numerical_type(from)) return false;
+            if (not lo_coerce(to, &coerced[n], from, argv[n])) return false;
+            coerced_argv[n] = &coerced[n];
+        }
+        return expected[n] == '\0' && types[n] == '\0';
+    }
+
+    void note_received(std::size_t i)
+    {
+        if (received[i]) ++outputs.coalesced_inputs.value;
+        received[i] = true;
+    }
+    bool intercept_clock_reply(const char * path, const char * types, lo_arg ** argv)
+    {
+        if (std::strcmp(path, osc_clock_reply_path) != 0 || std::strcmp(types, "ttt") != 0) return false;
+        clock_replies.try_push({from_timetag(argv[0]->t), from_timetag(argv[1]->t), from_timetag(argv[2]->t), clock()});
+        return true;
+    }
 
     template<typename T> static void
     set_input(const char *path, const char *types
@@ -128,6 +418,55 @@ struct LibloOsc
         if constexpr (has_name<T>) fprintf(stdout, "liblo: set input %s\n", name_of(in));
         else fprintf(stdout, "liblo: set unnamed input\n");
     };
+    bool enqueue_input(std::size_t i, const char * types, lo_arg ** argv)
+    {
+        input_record record;
+        record.endpoint = static_cast<unsigned short>(i);
+        osc_writer out{record.arguments};
+        for (std::size_t n = 0; types[n]; ++n)
+        {
+            switch (types[n])
+            {
+            case 'i': out.int32(argv[n]->i); break;
+            case 'f': out.float32(argv[n]->f); break;
+            case 's': out.string(&argv[n]->s); break;
+            default: return false;
+            }
+        }
+        if (out.overflow) return false;
+        record.length = static_cast<unsigned short>(out.length);
+        return receiver->queue.try_push(record);
+    }
+    using record_handler = bool (*)(const osc_message_view&, Components&);
+
+    template<typename Node>
+    static constexpr record_handler make_record_handler()
+    {
+        if constexpr (std::same_as<typename Node::tag, node::input_endpoint>)
+            return +[](const osc_message_view& message, Components& components)
+            {
+                return osc_decode_value(message, Node::get(components));
+            };
+        else return nullptr;
+    }
+
+    bool apply_queued_input()
+    {
+        using registry = endpoint_registry<Components>;
+        static constexpr auto handlers = []<typename ... Nodes>(boost::mp11::mp_list<Nodes...>)
+        {
+            return std::array<record_handler, registry::size>{make_record_handler<Nodes>()...};
+        }(typename registry::nodes{});
+
+        input_record record;
+        if (not receiver->queue.try_pop(record)) return false;
+        const auto& endpoint = registry::endpoints[record.endpoint];
+        osc_message_view message{ endpoint.path, endpoint.type_string + 1
+                                , record.arguments.data(), record.arguments.data() + record.length
+                                };
+        if (handlers[record.endpoint](message, *input_components)) note_received(record.endpoint);
+        return true;
+    }
 
     bool port_is_valid(auto& port)
     {
@@ -145,6 +484,7 @@ struct LibloOsc
         if (outputs.server_running && not (inputs.src_port.updated && valid_user_src_port)) return;
 
         fprintf(stdout, "liblo: setting up server\n");
+        stop_receiver();
         if (server) lo_server_free(server);
 
         if (not valid_user_src_port)
@@ -180,28 +520,8 @@ struct LibloOsc
             fprintf(stdout, "liblo: connected on port %s\n", inputs.src_port->c_str());
 
         fprintf(stderr, "liblo: registering callbacks\n");
-        for_each_input(components, [&]<typename T>(T& in)
-        {
-            fprintf(stdout, "liblo: registering callback for %s ... ", name_of(in));
-            constexpr auto handler = +[]( const char *path, const char *types
-                                        , lo_arg **argv, int argc, lo_message msg
-                                        , void *user_data
-                                        )
-            {
-                #ifndef NDEBUG
-                    fprintf(stdout, "liblo: got message %s", path);
-                    lo_message_pp(msg);
-                #endif
-                T& in = *(T*)user_data;
-                LibloOsc::set_input(path, types, argv, argc, msg, in);
-                return 0;
-            };
-            lo_server_add_method( server
-                                , osc_path_v<T, Components>, osc_type_string_v<T>+1
-                                , handler, (void*)&in
-                                );
-            fprintf(stdout, "done\n");
-        });
+        input_components = &components;
+        lo_server_add_method(server, NULL, NULL, &LibloOsc::dispatch, (void*)this);
         fprintf(stderr, "liblo: done registering callbacks\n");
 
         outputs.server_running = 1;
@@ -235,6 +555,31 @@ struct LibloOsc
             outputs.output_running = 0;
             fprintf(stderr, "liblo: unable to set destination address\n");
         }
+        set_dst_sockaddr();
+    }
+    void set_dst_sockaddr()
+    {
+        dst_socklen = 0;
+        frame_running = false; // resend the schema to the new destination
+        if (not outputs.output_running) return;
+        addrinfo hints{};
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_DGRAM;
+        addrinfo * info = nullptr;
+        if (getaddrinfo(inputs.dst_addr->c_str(), inputs.dst_port->c_str(), &hints, &info) != 0 || info == nullptr)
+        {
+            fprintf(stderr, "liblo: unable to resolve destination address for frame output\n");
+            return;
+        }
+        std::memcpy(&dst_sockaddr, info->ai_addr, info->ai_addrlen);
+        dst_socklen = info->ai_addrlen;
+        freeaddrinfo(info);
+    }
+
+    void send_raw(const char * data, std::size_t size)
+    {
+        if (not outputs.server_running || dst_socklen == 0) return;
+        sendto(lo_server_get_socket_fd(server), data, size, 0, (const sockaddr *)&dst_sockaddr, dst_socklen);
     }
 
     static void server_error_handler(int num, const char *msg, const char *where)
@@ -249,81 +594,227 @@ struct LibloOsc
         set_server(components);
         outputs.output_running = 0;
         set_dst();
+        lo_timetag now;
+        lo_timetag_now(&now);
+        wall_clock.set(from_timetag(now), clock());
     }
 
     void external_sources()
     {
-        if (outputs.server_running) lo_server_recv_noblock(server, 0);
+        unsigned long now = clock();
+        wall_clock.extend(now);
+        receive_inputs();
+        apply_clock_replies();
+        request_clock(now);
+        stamp_tick(now);
+    }
+
+    void receive_inputs()
+    {
+        if (not outputs.server_running) return;
+        received.fill(false);
+        int budget = inputs.input_budget > 0 ? inputs.input_budget.value : default_input_budget;
+        unsigned long time_budget = static_cast<unsigned long>(inputs.input_time_budget.value);
+        unsigned long start = time_budget ? clock() : 0;
+        int count = 0;
+        bool exhausted = false;
+        auto next = [&]() { return receiver ? apply_queued_input() : lo_server_recv_noblock(server, 0) > 0; };
+        while (next())
+        {
+            ++count;
+            exhausted = count >= budget || (time_budget && clock() - start >= time_budget);
+            if (exhausted) break;
+        }
+        outputs.input_queue_depth = count;
+        outputs.input_backlog = exhausted && (receiver ? not receiver->queue.empty() : lo_server_wait(server, 0) > 0);
+        outputs.dropped_inputs = dropped.load(std::memory_order_relaxed);
+    }
+
+    /// The server's socket, or -1 if the server isn't running or is read by the receive thread
+    int wait_descriptor() const
+    {
+        return outputs.server_running && not receiver ? lo_server_get_socket_fd(server) : -1;
+    }
+
+    /// Whether the next subroutine may reconfigure the server or destination used by the external destinations
+    bool conflicts_with_destinations() const
+    {
+        return not outputs.server_running
+            || inputs.src_port.updated
+            || inputs.dst_addr.updated
+            || inputs.dst_port.updated;
     }
     void main(Components& components)
     {
         set_server(components);
         set_dst();
+        if (inputs.receive_thread) start_receiver();
+        else stop_receiver();
     }
     void external_destinations(Components& components)
     {
+        lo_timetag time = bundle_timetag();
         if (outputs.output_running)
         {
-            lo_bundle bundle = lo_bundle_new(LO_TT_IMMEDIATE);
-            for_each_output(components, [&]<typename T>(T& output)
+            using registry = endpoint_registry<Components>;
+            unsigned long now = clock();
+            unsigned long period = inputs.output_rate > 0 ? 1000000ul / inputs.output_rate : 0;
+            send_frame(components);
+            for (std::size_t i = 0; i < registry::size; ++i)
             {
-                if constexpr (OccasionalValue<T> || Bang<T>)
-                {
-                    if (not flag_state_of(output))
-                        return;
-                }
-                else if constexpr (requires (T t) {t == output;})
-                {
-                    static T prev{};
-                    if (output == prev)
-                        return;
-                    prev = output;
-                }
+                const auto& endpoint = registry::endpoints[i];
+                if (endpoint.input || (inputs.frame_output && frame_t::included[i])) continue;
+                if (not limiter.due(i, cache.changed(i, components), now, period)) continue;
 
                 lo_message message = lo_message_new();
                 if (!message)
                 {
                     perror("liblo: unable to malloc new message. perror reports: \n");
-                    return;
+                    continue;
                 }
-                if constexpr (has_value<T> && not Bang<T>)
+                if (endpoint.value)
                 {
                     int ret = 0;
-                    // TODO: this type tag string logic should be moved to osc_string_constants.lili.md
-                    constexpr auto type = std::integral<element_t<T>> ? "i"
-                                        : std::floating_point<element_t<T>> ? "f"
-                                        : string_like<element_t<T>> ? "s" : "" ;
-                    // TODO: we should have a more generic way to get a char * from a string_like value
-                    if constexpr (string_like<value_t<T>>)
-                        ret = lo_message_add_string(message, value_of(output).c_str());
-                    else if constexpr (array_like<value_t<T>>)
+                    void * value = endpoint.value(components);
+                    for (std::size_t n = 0; n < endpoint.size && ret >= 0; ++n)
                     {
-                        for (auto& element : value_of(output))
+                        visit_element(endpoint.element, value, n, [&]<typename E>(E& element)
                         {
-                            ret = lo_message_add(message, type, element);
-                            if (ret < 0) break;
-                        }
+                            if constexpr (std::same_as<E, std::string>)
+                                ret = lo_message_add_string(message, element.c_str());
+                            else if constexpr (std::integral<E>)
+                                ret = lo_message_add(message, "i", element);
+                            else ret = lo_message_add(message, "f", element);
+                        });
                     }
-                    else ret = lo_message_add(message, type, value_of(output));
 
                     if (ret < 0)
                     {
                         lo_message_free(message);
-                        return;
+                        continue;
                     }
                 }
 
-                int ret = lo_bundle_add_message(bundle, osc_path_v<T, Components>, message);
-                if (ret < 0) fprintf(stderr, "liblo: unable to add message to bundle.\n");
-                //lo_message_free(message); // bundle makes its own ref to message on success, so we need to free ours regardless
-                return;
-            });
-            int ret = lo_send_bundle(dst, bundle);
-            //if (ret < 0) fprintf( stderr, "liblo: error %d sending bundle --- %s\n"
-            //                    , lo_address_errno(dst)
-            //                    , lo_address_errstr(dst)
-            //                    );
-            lo_bundle_free_recursive(bundle);
+                stage(endpoint, message, time);
+            }
+            flush_group(time);
+            send_bundle();
+            outputs.suppressed_outputs = static_cast<int>(limiter.suppressed);
+        }
+    }
+    std::size_t bundle_budget() const
+    {
+        return inputs.bundle_size > 0 ? static_cast<std::size_t>(inputs.bundle_size) : default_bundle_size;
+    }
+
+    void stage(const endpoint_descriptor<Components>& endpoint, lo_message message, lo_timetag time)
+    {
+        if (group_count > 0 && endpoint.component != group_component) flush_group(time);
+        group_component = endpoint.component;
+        std::size_t size = 4 + lo_message_length(message, endpoint.path);
+        group[group_count++] = {endpoint.path, message, size};
+        group_length += size;
+    }
+
+    void flush_group(lo_timetag time)
+    {
+        if (bundle_length + group_length > bundle_budget()) send_bundle();
+        for (std::size_t n = 0; n < group_count; ++n)
+        {
+            auto& staged = group[n];
+            if (bundle_length + staged.size > bundle_budget()) send_bundle();
+            if (not bundle)
+            {
+                bundle = lo_bundle_new(time);
+                bundle_length = bundle_header_size;
+            }
+            int ret = lo_bundle_add_message(bundle, staged.path, staged.message);
+            if (ret < 0) fprintf(stderr, "liblo: unable to add message to bundle.\n");
+            //lo_message_free(message); // bundle makes its own ref to message on success, so we need to free ours regardless
+            bundle_length += staged.size;
+        }
+        group_count = 0;
+        group_length = 0;
+    }
+
+    void send_bundle()
+    {
+        if (not bundle) return;
+        int ret = lo_send_bundle(dst, bundle);
+        //if (ret < 0) fprintf( stderr, "liblo: error %d sending bundle --- %s\n"
+        //                    , lo_address_errno(dst)
+        //                    , lo_address_errstr(dst)
+        //                    );
+        lo_bundle_free_recursive(bundle);
+        bundle = nullptr;
+        bundle_length = 0;
+    }
+    void send_frame(Components& components)
+    {
+        if (not inputs.frame_output)
+        {
+            frame_running = false;
+            return;
+        }
+        if (not frame_running)
+        {
+            send_raw(frame_t::schema_message.data(), frame_t::schema_message.size());
+            frame.dirty = true;
+            frame_running = true;
+        }
+        if (frame.update(components)) send_raw(frame.message.data(), frame.message.size());
+    }
+    void start_receiver()
+    {
+        if (receiver || not outputs.server_running) return;
+        receiver = std::make_unique<receiver_t>();
+        receiver->thread = std::thread{[this, r = receiver.get()]()
+        {
+            while (r->running.load(std::memory_order_relaxed))
+                lo_server_recv_noblock(server, receive_timeout_ms);
+        }};
+    }
+
+    void stop_receiver()
+    {
+        if (not receiver) return;
+        receiver->running = false;
+        receiver->thread.join();
+        while (apply_queued_input()) {}
+        receiver.reset();
+    }
+    void stamp_tick(unsigned long now)
+    {
+        tick_stamps.try_push(wall_clock.timetag(now));
+    }
+
+    /// The time tag of the bundles of the tick whose outputs are being sent
+    lo_timetag bundle_timetag()
+    {
+        std::uint64_t stamp;
+        bool stamped = tick_stamps.try_pop(stamp);
+        if (not inputs.timestamp_bundles || not stamped) return LO_TT_IMMEDIATE;
+        return to_timetag(stamp);
+    }
+    void request_clock(unsigned long now)
+    {
+        if (inputs.clock_sync_interval <= 0) return;
+        unsigned long interval = 1000000ul * static_cast<unsigned long>(inputs.clock_sync_interval.value);
+        if (clock_requested && now - last_clock_request < interval) return;
+        std::array<char, 32> buffer;
+        osc_writer request{buffer};
+        osc_clock_request(request, wall_clock.local(now));
+        send_raw(buffer.data(), request.length);
+        last_clock_request = now;
+        clock_requested = true;
+    }
+    void apply_clock_replies()
+    {
+        clock_reply reply;
+        while (clock_replies.try_pop(reply))
+        {
+            auto delay = wall_clock.exchange(reply.origin, reply.receive, reply.transmit, wall_clock.local(reply.destination));
+            outputs.clock_delay = static_cast<int>(std::min<std::uint64_t>(delay, 1000000));
         }
     }
 };
@@ -7,7 +7,10 @@ Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
 SPDX-License-Identifier: LGPL-2.1-or-later
 */
 
+#include <chrono>
 #include <string>
+#include <thread>
+#include <vector>
 #include <catch2/catch_test_macros.hpp>
 #include "sygac-components.hpp"
 #include "sygah-endpoints.hpp"
@@ -29,3 +32,439 @@ TEST_CASE("sygaldry liblo osc port is valid")
     CHECK(osc.port_is_valid(s2));
     CHECK(not osc.port_is_valid(s3));
 }
+void add_argument(lo_message m, int i) { lo_message_add_int32(m, i); }
+void add_argument(lo_message m, float f) { lo_message_add_float(m, f); }
+void add_argument(lo_message m, const char * s) { lo_message_add_string(m, s); }
+
+template<typename ... Args>
+void send_to(lo_address address, const char * path, Args ... args)
+{
+    lo_message m = lo_message_new();
+    (add_argument(m, args), ...);
+    lo_send_message(address, path, m);
+    lo_message_free(m);
+}
+
+lo_address loopback_to(auto& osc)
+{
+    return lo_address_new("127.0.0.1", osc.inputs.src_port->c_str());
+}
+
+struct loopback_receiver
+{
+    struct message_t
+    {
+        string path;
+        float value;
+    };
+    struct bundle_t
+    {
+        lo_timetag time;
+        std::vector<message_t> messages;
+    };
+
+    lo_server server;
+    std::vector<bundle_t> bundles{};
+
+    loopback_receiver() : server{lo_server_new(NULL, NULL)}
+    {
+        lo_server_enable_queue(server, 0, 1); // dispatch bundles right away, whatever their time tag
+        lo_server_add_bundle_handlers(server, &loopback_receiver::start, &loopback_receiver::end, this);
+        lo_server_add_method(server, NULL, NULL, &loopback_receiver::message, this);
+    }
+    ~loopback_receiver() { lo_server_free(server); }
+
+    static int start(lo_timetag time, void * user_data)
+    {
+        ((loopback_receiver*)user_data)->bundles.push_back({time, {}});
+        return 0;
+    }
+    static int end(void *) { return 0; }
+    static int message(const char * path, const char * types, lo_arg ** argv, int, lo_message, void * user_data)
+    {
+        auto& self = *(loopback_receiver*)user_data;
+        if (self.bundles.empty()) return 0;
+        self.bundles.back().messages.push_back({path, types[0] == 'f' ? argv[0]->f : 0.0f});
+        return 0;
+    }
+
+    string port() const { return std::to_string(lo_server_get_port(server)); }
+
+    /// Receive the bundles sent since the last call
+    std::vector<bundle_t>& receive()
+    {
+        bundles.clear();
+        while (lo_server_recv_noblock(server, 0) > 0) {}
+        return bundles;
+    }
+
+    /// The last message received to `path` in the bundles returned by `receive`, or null
+    const message_t * find(const char * path) const
+    {
+        const message_t * ret = nullptr;
+        for (const auto& bundle : bundles)
+            for (const auto& message : bundle.messages)
+                if (message.path == path) ret = &message;
+        return ret;
+    }
+};
+
+unsigned long liblo_test_time = 0;
+unsigned long liblo_test_step = 0; // added to the time whenever the clock is read
+unsigned long liblo_test_clock() { return liblo_test_time += liblo_test_step; }
+using test_osc = LibloOsc<TestComponent, liblo_test_clock>;
+
+/// Initialize the binding with `receiver` as its destination
+void connect(auto& osc, const loopback_receiver& receiver, auto& components)
+{
+    osc.inputs.dst_addr = string("127.0.0.1");
+    osc.inputs.dst_port = receiver.port();
+    osc.init(components);
+}
+
+TEST_CASE("sygaldry liblo coerces numeric arguments")
+{
+    TestComponent tc{};
+    LibloOsc<TestComponent> osc{};
+    osc.init(tc);
+    REQUIRE(osc.outputs.server_running);
+    lo_address address = loopback_to(osc);
+
+    send_to(address, "/Test_Component_1/slider_in", 1);
+    osc.external_sources();
+    CHECK(tc.inputs.slider_in.value == 1.0f);
+
+    send_to(address, "/Test_Component_1/array_in", 1, 0.5f, 2);
+    osc.external_sources();
+    CHECK(tc.inputs.array_in.value == std::array<float, 3>{1.0f, 0.5f, 2.0f});
+
+    send_to(address, "/Test_Component_1/toggle_in", 1.0f);
+    osc.external_sources();
+    CHECK(tc.inputs.toggle_in.value == 1);
+
+    send_to(address, "/Test_Component_1/slider_in", "0.5");
+    send_to(address, "/Test_Component_1/array_in", 1, 2);
+    osc.external_sources();
+    CHECK(tc.inputs.slider_in.value == 1.0f);
+    CHECK(osc.outputs.dropped_inputs == 2);
+
+    lo_address_free(address);
+}
+
+TEST_CASE("sygaldry liblo dispatches address patterns")
+{
+    TestComponent tc{};
+    LibloOsc<TestComponent> osc{};
+    osc.init(tc);
+    REQUIRE(osc.outputs.server_running);
+    lo_address address = loopback_to(osc);
+
+    send_to(address, "/Test_Component_1/slider_*", 0.5f);
+    osc.external_sources();
+    CHECK(tc.inputs.slider_in.value == 0.5f);
+    CHECK(osc.outputs.dropped_inputs == 0);
+
+    // patterns that don't compile match nothing and are dropped
+    send_to(address, "/Test_Component_1/[slider_in", 0.25f);
+    std::string too_long = "/Test_Component_1/slider_{in";
+    for (std::size_t i = 0; i < osc_compiled_pattern::max_instructions; ++i) too_long += ",xx";
+    too_long += "}";
+    send_to(address, too_long.c_str(), 0.25f);
+    osc.external_sources();
+    CHECK(tc.inputs.slider_in.value == 0.5f);
+    CHECK(osc.outputs.dropped_inputs == 2);
+
+    lo_address_free(address);
+}
+TEST_CASE("sygaldry liblo drains input within a budget")
+{
+    const char * slider = "/Test_Component_1/slider_in";
+    liblo_test_time = 0;
+    liblo_test_step = 0;
+    TestComponent tc{};
+    test_osc osc{};
+    osc.init(tc);
+    REQUIRE(osc.outputs.server_running);
+    lo_address address = loopback_to(osc);
+
+    SECTION("message budget")
+    {
+        osc.inputs.input_budget = 2;
+        for (int i = 1; i <= 5; ++i) send_to(address, slider, static_cast<float>(i));
+
+        osc.external_sources();
+        CHECK(osc.outputs.input_queue_depth == 2);
+        CHECK(osc.outputs.input_backlog);
+        CHECK(tc.inputs.slider_in.value == 2.0f);
+        CHECK(osc.outputs.coalesced_inputs == 1);
+
+        osc.external_sources(); // the next tick resumes where the last one stopped
+        CHECK(osc.outputs.input_queue_depth == 2);
+        CHECK(osc.outputs.input_backlog);
+        CHECK(tc.inputs.slider_in.value == 4.0f);
+
+        osc.external_sources();
+        CHECK(osc.outputs.input_queue_depth == 1);
+        CHECK(not osc.outputs.input_backlog);
+        CHECK(tc.inputs.slider_in.value == 5.0f);
+
+        osc.external_sources();
+        CHECK(osc.outputs.input_queue_depth == 0);
+        CHECK(osc.outputs.coalesced_inputs == 2);
+    }
+
+    SECTION("time budget")
+    {
+        osc.inputs.input_time_budget = 250;
+        liblo_test_step = 100;
+        for (int i = 1; i <= 5; ++i) send_to(address, slider, static_cast<float>(i));
+
+        osc.external_sources(); // stops once 300 us have passed
+        CHECK(osc.outputs.input_queue_depth == 3);
+        CHECK(osc.outputs.input_backlog);
+        CHECK(tc.inputs.slider_in.value == 3.0f);
+
+        osc.external_sources();
+        CHECK(osc.outputs.input_queue_depth == 2);
+        CHECK(not osc.outputs.input_backlog);
+        CHECK(tc.inputs.slider_in.value == 5.0f);
+        liblo_test_step = 0;
+    }
+
+    lo_address_free(address);
+}
+
+TEST_CASE("sygaldry liblo reports conflicts with its external destinations")
+{
+    TestComponent tc{};
+    loopback_receiver receiver{};
+    test_osc osc{};
+    CHECK(osc.conflicts_with_destinations()); // the server isn't running yet
+    connect(osc, receiver, tc);
+    clear_flag(osc.inputs.dst_addr);
+    clear_flag(osc.inputs.dst_port);
+    CHECK(not osc.conflicts_with_destinations());
+
+    osc.inputs.dst_port = receiver.port();
+    CHECK(osc.conflicts_with_destinations());
+    osc.main(tc);
+    clear_flag(osc.inputs.dst_port);
+    CHECK(not osc.conflicts_with_destinations());
+}
+struct bundle_test_components
+{
+    TestComponent tc1;
+    TestComponent tc2;
+};
+static_assert(LibloOsc<TestComponent>::max_group_size == 7);
+static_assert(LibloOsc<bundle_test_components>::max_group_size == 7);
+
+struct group_one_component : name_<"one">
+{
+    struct outputs_t {
+        slider<"a"> a;
+        slider<"b"> b;
+        slider<"c"> c;
+    } outputs;
+    void main() {}
+};
+
+struct group_two_component : name_<"two">
+{
+    struct outputs_t {
+        slider<"d"> d;
+        slider<"e"> e;
+        slider<"f"> f;
+    } outputs;
+    void main() {}
+};
+
+struct group_test_components
+{
+    group_one_component one;
+    group_two_component two;
+};
+
+// each message, e.g. /one/a with a float, takes 8 + 4 + 4 bytes, plus 4 for its size
+constexpr std::size_t group_test_message_size = 20;
+
+void change_groups(group_test_components& components, float value)
+{
+    components.one.outputs.a = value;
+    components.one.outputs.b = value;
+    components.one.outputs.c = value;
+    components.two.outputs.d = value;
+    components.two.outputs.e = value;
+    components.two.outputs.f = value;
+}
+
+std::vector<std::size_t> bundle_sizes(const std::vector<loopback_receiver::bundle_t>& bundles)
+{
+    std::vector<std::size_t> ret{};
+    for (const auto& bundle : bundles) ret.push_back(bundle.messages.size());
+    return ret;
+}
+
+TEST_CASE("sygaldry liblo splits bundles at the size budget")
+{
+    using sizes = std::vector<std::size_t>;
+    constexpr auto header = LibloOsc<group_test_components>::bundle_header_size;
+    constexpr auto message = group_test_message_size;
+    group_test_components components{};
+    loopback_receiver receiver{};
+    LibloOsc<group_test_components, liblo_test_clock> osc{};
+    connect(osc, receiver, components);
+    REQUIRE(osc.outputs.output_running);
+
+    // both groups fit exactly
+    osc.inputs.bundle_size = static_cast<int>(header + 6 * message);
+    change_groups(components, 0.1f);
+    osc.external_destinations(components);
+    CHECK(bundle_sizes(receiver.receive()) == sizes{6});
+
+    // one byte less, and the second group starts a new bundle rather than being split
+    osc.inputs.bundle_size = static_cast<int>(header + 6 * message - 1);
+    change_groups(components, 0.2f);
+    osc.external_destinations(components);
+    CHECK(bundle_sizes(receiver.receive()) == sizes{3, 3});
+    CHECK(receiver.bundles[1].messages[0].path == "/two/d");
+
+    // a group that doesn't fit in a bundle on its own is split across bundles
+    osc.inputs.bundle_size = static_cast<int>(header + 2 * message);
+    change_groups(components, 0.3f);
+    osc.external_destinations(components);
+    CHECK(bundle_sizes(receiver.receive()) == sizes{2, 1, 2, 1});
+    CHECK(receiver.bundles[1].messages[0].path == "/one/c");
+    CHECK(receiver.bundles[2].messages[0].path == "/two/d");
+
+    // unchanged outputs send no bundle at all
+    osc.external_destinations(components);
+    CHECK(receiver.receive().empty());
+}
+TEST_CASE("sygaldry liblo rate limits continuous outputs")
+{
+    const char * slider = "/Test_Component_1/slider_out";
+    liblo_test_time = 0;
+    TestComponent tc{};
+    loopback_receiver receiver{};
+    test_osc osc{};
+    osc.inputs.output_rate = 100; // a period of 10 ms
+    connect(osc, receiver, tc);
+    REQUIRE(osc.outputs.output_running);
+
+    tc.outputs.slider_out = 0.5f;
+    osc.external_destinations(tc);
+    receiver.receive();
+    REQUIRE(receiver.find(slider));
+    CHECK(receiver.find(slider)->value == 0.5f);
+
+    liblo_test_time = 1000;
+    tc.outputs.slider_out = 0.6f;
+    osc.external_destinations(tc);
+    liblo_test_time = 2000;
+    tc.outputs.slider_out = 0.7f;
+    osc.external_destinations(tc);
+    receiver.receive();
+    CHECK(receiver.find(slider) == nullptr); // held back until the period has elapsed
+    CHECK(osc.outputs.suppressed_outputs == 1); // 0.6 was replaced before it could be sent
+
+    liblo_test_time = 9999;
+    osc.external_destinations(tc);
+    receiver.receive();
+    CHECK(receiver.find(slider) == nullptr);
+
+    liblo_test_time = 10000;
+    osc.external_destinations(tc);
+    receiver.receive();
+    REQUIRE(receiver.find(slider));
+    CHECK(receiver.find(slider)->value == 0.7f); // the latest value is sent without a new change
+
+    liblo_test_time = 30000;
+    osc.external_destinations(tc);
+    receiver.receive();
+    CHECK(receiver.find(slider) == nullptr); // nothing pending
+}
+// the text input of the test component is the largest
+static_assert(LibloOsc<TestComponent>::input_record_size == LibloOsc<TestComponent>::input_string_capacity);
+TEST_CASE("sygaldry liblo receive thread")
+{
+    liblo_test_time = 0;
+    liblo_test_step = 0;
+    TestComponent tc{};
+    test_osc osc{};
+    osc.init(tc);
+    REQUIRE(osc.outputs.server_running);
+    int runtime_descriptor = osc.wait_descriptor();
+    lo_address address = loopback_to(osc);
+
+    osc.inputs.receive_thread = 1;
+    osc.main(tc);
+    CHECK(osc.wait_descriptor() == -1);
+    send_to(address, "/Test_Component_1/slider_in", 1); // coerced before it is queued
+    send_to(address, "/Test_Component_1/text_in", "received");
+    send_to(address, "/Test_Component_1/nothing", 1);
+    for (int tries = 0; tries < 100 && tc.inputs.text_in.value != "received"; ++tries)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        osc.external_sources();
+    }
+    CHECK(tc.inputs.slider_in.value == 1.0f);
+    CHECK(tc.inputs.text_in.value == "received");
+
+    osc.inputs.receive_thread = 0;
+    osc.main(tc);
+    CHECK(osc.wait_descriptor() == runtime_descriptor);
+    send_to(address, "/Test_Component_1/slider_in", 2.0f);
+    osc.external_sources();
+    CHECK(tc.inputs.slider_in.value == 2.0f);
+    CHECK(osc.outputs.dropped_inputs == 1);
+
+    lo_address_free(address);
+}
+TEST_CASE("sygaldry liblo bundle time tags")
+{
+    liblo_test_time = 0;
+    liblo_test_step = 0;
+    TestComponent tc{};
+    loopback_receiver receiver{};
+    test_osc osc{};
+    connect(osc, receiver, tc);
+    REQUIRE(osc.outputs.output_running);
+    auto micros_between = [](lo_timetag a, lo_timetag b)
+    {
+        return osc_timetag_to_micros(static_cast<std::int64_t>(test_osc::from_timetag(b) - test_osc::from_timetag(a)));
+    };
+    auto send = [&](float value)
+    {
+        tc.outputs.slider_out = value;
+        osc.external_destinations(tc);
+        auto& bundles = receiver.receive();
+        REQUIRE(bundles.size() == 1);
+        return bundles[0].time;
+    };
+
+    liblo_test_time = 1000;
+    osc.external_sources();
+    liblo_test_time = 3000;
+    auto immediate = send(0.1f);
+    CHECK(immediate.sec == 0);
+    CHECK(immediate.frac == 1);
+
+    osc.inputs.timestamp_bundles = 1;
+    liblo_test_time = 11000;
+    osc.external_sources();
+    liblo_test_time = 15000;
+    auto first = send(0.2f);
+
+    // as with the pipelined runtime, the next tick begins before the outputs of the last one are sent
+    liblo_test_time = 21000;
+    osc.external_sources();
+    liblo_test_time = 31000;
+    osc.external_sources();
+    liblo_test_time = 32000;
+    auto second = send(0.3f);
+    auto third = send(0.4f);
+
+    CHECK(micros_between(first, second) == 10000); // the time of the tick, not that of sending
+    CHECK(micros_between(second, third) == 10000);
+}
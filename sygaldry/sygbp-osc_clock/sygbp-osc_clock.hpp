@@ -0,0 +1,157 @@
+#pragma once
+/*
+Copyright 2026 Travis J. West, https://traviswest.ca, Input Devices and Music
+Interaction Laboratory (IDMIL), Centre for Interdisciplinary Research in Music
+Media and Technology (CIRMMT), McGill University, Montréal, Canada, and Univ.
+Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
+
+SPDX-License-Identifier: MIT
+*/
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include "sygbp-osc_packet.hpp"
+
+namespace sygaldry { namespace sygbp {
+///\addtogroup sygbp
+///\{
+///\defgroup sygbp-osc_clock sygbp-osc_clock: OSC Time Tags and Clock Synchronization
+///\{
+
+/// Convert a duration in microseconds to the 32.32 fixed point seconds of an OSC time tag
+constexpr std::uint64_t osc_micros_to_timetag(std::uint64_t us)
+{
+    return ((us / 1000000) << 32) | (((us % 1000000) << 32) / 1000000);
+}
+
+/// Convert a signed duration in the fixed point format of OSC time tags to the nearest microsecond
+constexpr std::int64_t osc_timetag_to_micros(std::int64_t t)
+{
+    bool negative = t < 0;
+    std::uint64_t magnitude = negative ? -static_cast<std::uint64_t>(t) : static_cast<std::uint64_t>(t);
+    std::uint64_t us = (magnitude >> 32) * 1000000 + (((magnitude & 0xffffffffu) * 1000000 + (1ull << 31)) >> 32);
+    return negative ? -static_cast<std::int64_t>(us) : static_cast<std::int64_t>(us);
+}
+
+/*! \brief Maps timestamps in microseconds to OSC time tags
+
+\tparam Timestamp The type of the timestamps, e.g. as returned by `sygsp::micros`
+*/
+template<std::unsigned_integral Timestamp = unsigned long>
+struct osc_clock
+{
+    /// The offset from local time to wall clock time, in the fixed point format of time tags
+    std::uint64_t offset = 0;
+
+    /// Extend `timestamp` to 64 bits, accounting for wrap around
+    std::uint64_t extend(Timestamp timestamp)
+    {
+        if constexpr (sizeof(Timestamp) >= sizeof(std::uint64_t)) return timestamp;
+        else
+        {
+            constexpr std::uint64_t wrap = std::uint64_t(1) << (8 * sizeof(Timestamp));
+            constexpr Timestamp half = static_cast<Timestamp>(wrap / 2);
+            if (not started || static_cast<Timestamp>(timestamp - latest) < half)
+            {
+                started = true;
+                if (timestamp < latest) epoch += wrap;
+                latest = timestamp;
+                return epoch + timestamp;
+            }
+            if (timestamp > latest && epoch >= wrap) return epoch - wrap + timestamp;
+            return epoch + timestamp;
+        }
+    }
+
+    /// The local time of `timestamp` as a time tag, without the offset
+    std::uint64_t local(Timestamp timestamp) { return osc_micros_to_timetag(extend(timestamp)); }
+
+    /// The wall clock time of `timestamp` as a time tag
+    std::uint64_t timetag(Timestamp timestamp) { return local(timestamp) + offset; }
+
+    /// Set the offset so that `timestamp` corresponds to the wall clock time tag `wall`
+    void set(std::uint64_t wall, Timestamp timestamp) { offset = wall - local(timestamp); }
+
+    /// The number of recent estimates among which the best is used
+    static constexpr std::size_t window = 8;
+
+    /// An estimate of the offset of the peer's clock, and the round trip delay of the exchange that produced it
+    struct estimate
+    {
+        std::uint64_t offset;
+        std::uint64_t delay;
+    };
+
+    /*! \brief Estimate the offset of the clock from an exchange with a peer, returning the new round trip delay in microseconds
+
+    \param origin The local time at which the request was sent, as returned by `local`
+    \param receive The peer's time at which it received the request
+    \param transmit The peer's time at which it sent the reply
+    \param destination The local time at which the reply was received, as returned by `local`
+    */
+    std::uint64_t exchange(std::uint64_t origin, std::uint64_t receive, std::uint64_t transmit, std::uint64_t destination)
+    {
+        auto delay = static_cast<std::int64_t>((destination - origin) - (transmit - receive));
+        if (delay < 0) delay = 0;
+        estimates[next] = {(receive - origin) - static_cast<std::uint64_t>(delay / 2), static_cast<std::uint64_t>(delay)};
+        next = (next + 1) % window;
+        count = count < window ? count + 1 : window;
+        std::size_t best = 0;
+        for (std::size_t i = 1; i < count; ++i)
+            if (estimates[i].delay < estimates[best].delay) best = i;
+        offset = estimates[best].offset;
+        return static_cast<std::uint64_t>(osc_timetag_to_micros(static_cast<std::int64_t>(estimates[best].delay)));
+    }
+
+    /// Whether the offset has been estimated from at least one exchange
+    bool synchronized() const { return count > 0; }
+
+    std::array<estimate, window> estimates{};
+    std::size_t next = 0;
+    std::size_t count = 0;
+
+private:
+    std::uint64_t epoch = 0;
+    Timestamp latest = 0;
+    bool started = false;
+};
+
+inline constexpr const char * osc_clock_request_path = "/clock/request";
+inline constexpr const char * osc_clock_reply_path = "/clock/reply";
+
+/// Write a clock request with the local time `origin` to `out`
+constexpr void osc_clock_request(osc_writer& out, std::uint64_t origin)
+{
+    out.string(osc_clock_request_path);
+    out.string(",t");
+    out.timetag(origin);
+}
+
+/// Read the time tags of a clock reply, returning false if `message` isn't one
+constexpr bool osc_clock_parse_reply(const osc_message_view& message, std::uint64_t& origin, std::uint64_t& receive, std::uint64_t& transmit)
+{
+    if (std::string_view{message.path} != osc_clock_reply_path) return false;
+    osc_argument_reader in{message};
+    return in.read(origin) && in.read(receive) && in.read(transmit) && in.type() == '\0';
+}
+/// Write the reply of a peer that received `request` at its time `receive` and replies at its time `transmit`, returning false if `request` isn't a clock request
+constexpr bool osc_clock_reply(const osc_message_view& request, std::uint64_t receive, std::uint64_t transmit, osc_writer& out)
+{
+    if (std::string_view{request.path} != osc_clock_request_path) return false;
+    osc_argument_reader in{request};
+    std::uint64_t origin{};
+    if (not in.read(origin) || in.type() != '\0') return false;
+    out.string(osc_clock_reply_path);
+    out.string(",ttt");
+    out.timetag(origin);
+    out.timetag(receive);
+    out.timetag(transmit);
+    return not out.overflow;
+}
+
+///\}
+///\}
+} }
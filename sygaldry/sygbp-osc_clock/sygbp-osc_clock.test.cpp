@@ -0,0 +1,93 @@
+/*
+Copyright 2026 Travis J. West, https://traviswest.ca, Input Devices and Music
+Interaction Laboratory (IDMIL), Centre for Interdisciplinary Research in Music
+Media and Technology (CIRMMT), McGill University, Montréal, Canada, and Univ.
+Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
+
+SPDX-License-Identifier: MIT
+*/
+
+#include <array>
+#include <cstdint>
+#include <catch2/catch_test_macros.hpp>
+#include "sygbp-osc_clock.hpp"
+
+using namespace sygaldry;
+using namespace sygaldry::sygbp;
+
+static_assert(osc_micros_to_timetag(0) == 0);
+static_assert(osc_micros_to_timetag(1000000) == 1ull << 32);
+static_assert(osc_micros_to_timetag(500000) == 1ull << 31);
+static_assert(osc_timetag_to_micros(1ll << 31) == 500000);
+static_assert(osc_timetag_to_micros(-(1ll << 32)) == -1000000);
+static_assert(osc_timetag_to_micros(static_cast<std::int64_t>(osc_micros_to_timetag(123456))) == 123456);
+TEST_CASE("sygaldry osc_clock")
+{
+    SECTION("time tags")
+    {
+        osc_clock<> clock{};
+        clock.set(100ull << 32, 1000000);
+        CHECK(clock.timetag(1000000) == 100ull << 32);
+        CHECK(clock.timetag(1500000) == (100ull << 32) + (1ull << 31));
+    }
+    SECTION("wrap around")
+    {
+        osc_clock<std::uint16_t> clock{};
+        CHECK(clock.extend(60000) == 60000);
+        CHECK(clock.extend(100) == 65636); // wrapped
+        CHECK(clock.extend(65000) == 65000); // earlier, before the wrap around
+        CHECK(clock.extend(200) == 65736); // later, after the wrap around
+        CHECK(clock.extend(30000) == 95536);
+        CHECK(clock.extend(60000) == 125536);
+        CHECK(clock.extend(5000) == 136072); // wrapped again
+    }
+}
+TEST_CASE("sygaldry osc_clock exchange with a stand-in peer")
+{
+    // the peer's clock reads 1000 s plus the local time, so its offset is 1000 s
+    constexpr std::uint64_t peer_offset = 1000ull << 32;
+    auto peer = [](unsigned long local_us) { return osc_micros_to_timetag(local_us) + peer_offset; };
+    osc_clock<> clock{};
+    std::array<char, 64> request_buffer{}, reply_buffer{};
+
+    // one exchange, given the local times at which each step happens
+    auto exchange = [&](unsigned long sent, unsigned long received, unsigned long replied, unsigned long returned)
+    {
+        osc_writer request{request_buffer};
+        osc_clock_request(request, clock.local(sent));
+        osc_message_view message{};
+        REQUIRE(osc_parse_message(request_buffer.data(), request.length, message));
+        osc_writer reply{reply_buffer};
+        REQUIRE(osc_clock_reply(message, peer(received), peer(replied), reply));
+        REQUIRE(osc_parse_message(reply_buffer.data(), reply.length, message));
+        std::uint64_t origin{}, receive{}, transmit{};
+        REQUIRE(osc_clock_parse_reply(message, origin, receive, transmit));
+        return clock.exchange(origin, receive, transmit, clock.local(returned));
+    };
+
+    CHECK(not clock.synchronized());
+
+    // a symmetric exchange with a round trip delay of 10 ms gives the exact offset
+    CHECK(exchange(1000, 6000, 6100, 11100) == 10000);
+    CHECK(clock.synchronized());
+    CHECK(osc_timetag_to_micros(static_cast<std::int64_t>(clock.offset - peer_offset)) == 0);
+    CHECK(clock.timetag(2000000) - peer(2000000) < 5);
+
+    // an asymmetric exchange with a longer delay is ignored in favour of the better estimate
+    CHECK(exchange(20000, 21000, 21000, 60000) == 10000);
+    CHECK(osc_timetag_to_micros(static_cast<std::int64_t>(clock.offset - peer_offset)) == 0);
+
+    // a faster asymmetric exchange is preferred, with an error of half the asymmetry
+    CHECK(exchange(100000, 101000, 101000, 103000) == 3000);
+    CHECK(osc_timetag_to_micros(static_cast<std::int64_t>(clock.offset - peer_offset)) == -500);
+
+    // other messages are not replies
+    osc_writer other{reply_buffer};
+    other.string("/clock/other");
+    other.string(",ttt");
+    other.timetag(0); other.timetag(0); other.timetag(0);
+    osc_message_view message{};
+    REQUIRE(osc_parse_message(reply_buffer.data(), other.length, message));
+    std::uint64_t t;
+    CHECK(not osc_clock_parse_reply(message, t, t, t));
+}
@@ -0,0 +1,288 @@
+#pragma once
+/*
+Copyright 2026 Travis J. West, https://traviswest.ca, Input Devices and Music
+Interaction Laboratory (IDMIL), Centre for Interdisciplinary Research in Music
+Media and Technology (CIRMMT), McGill University, Montréal, Canada, and Univ.
+Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
+
+SPDX-License-Identifier: MIT
+*/
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <string_view>
+#include <boost/mp11.hpp>
+#include "sygac-metadata.hpp"
+#include "sygac-endpoints.hpp"
+#include "sygac-components.hpp"
+#include "sygbp-spelling.hpp"
+#include "sygbp-osc_string_constants.hpp"
+#include "sygbp-endpoint_registry.hpp"
+#include "sygbp-osc_packet.hpp"
+
+namespace sygaldry { namespace sygbp {
+///\addtogroup sygbp
+///\{
+///\defgroup sygbp-osc_frame sygbp-osc_frame: OSC Frame Messages
+///\{
+
+/// Whether an endpoint of type `T` can be included in an OSC frame
+template<typename T>
+constexpr bool osc_frame_endpoint()
+{
+    if constexpr (not has_value<T>) return false;
+    else if constexpr (Bang<T> || ClearableFlag<T> || tagged_write_only<T>) return false;
+    else return std::integral<element_t<T>> || std::floating_point<element_t<T>>;
+}
+
+/// The number of OSC arguments of an endpoint of type `T`
+template<typename T>
+constexpr std::size_t osc_argument_count()
+{
+    if constexpr (array_like<value_t<T>>) return size<value_t<T>>();
+    else return 1;
+}
+
+/*! \brief The compile-time layout and message buffer of an OSC frame of the continuous outputs of `Components`
+
+\details Call `update` on each tick to patch the current values of the
+outputs into `message`, and send the message if it returns true. Publish
+`schema_message` so that receivers can decode the frame.
+*/
+template<typename Components>
+struct osc_frame
+{
+    template<typename Node>
+    using is_frame_node = boost::mp11::mp_bool
+        <  node::is_output_endpoint<typename Node::tag>::value
+        && osc_frame_endpoint<typename Node::type>()
+        >;
+
+    /// The endpoint registry of the container
+    using registry = endpoint_registry<Components>;
+
+    /// The entries of the frame's endpoints in the node index of the container
+    using nodes = boost::mp11::mp_copy_if<typename registry::nodes, is_frame_node>;
+
+    /// The number of endpoints in the frame
+    static constexpr std::size_t size = boost::mp11::mp_size<nodes>::value;
+
+    /// Whether each endpoint of the registry is included in the frame
+    static constexpr std::array<bool, registry::size> included = []<typename ... Nodes>(boost::mp11::mp_list<Nodes...>)
+    {
+        return std::array<bool, registry::size>{is_frame_node<Nodes>::value...};
+    }(typename registry::nodes{});
+
+    /// The OSC addresses of the frame's endpoints
+    static constexpr std::array<const char *, size> paths = []<typename ... Nodes>(boost::mp11::mp_list<Nodes...>)
+    {
+        return std::array<const char *, size>{osc_path_v<typename Nodes::type, Components>...};
+    }(nodes{});
+
+    /// The number of arguments of each of the frame's endpoints
+    static constexpr std::array<std::size_t, size> counts = []<typename ... Nodes>(boost::mp11::mp_list<Nodes...>)
+    {
+        return std::array<std::size_t, size>{osc_argument_count<typename Nodes::type>()...};
+    }(nodes{});
+
+    /// The type tag of each of the frame's endpoints
+    static constexpr std::array<char, size> tags = []<typename ... Nodes>(boost::mp11::mp_list<Nodes...>)
+    {
+        return std::array<char, size>{osc_type_string<typename Nodes::type>::value[1]...};
+    }(nodes{});
+
+    /// The index of the first argument of each of the frame's endpoints
+    static constexpr std::array<std::size_t, size> indices = []()
+    {
+        std::array<std::size_t, size> ret{};
+        std::size_t index = 0;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            ret[i] = index;
+            index += counts[i];
+        }
+        return ret;
+    }();
+
+    /// The number of arguments of the frame message
+    static constexpr std::size_t arguments = []()
+    {
+        std::size_t ret = 0;
+        for (auto count : counts) ret += count;
+        return ret;
+    }();
+
+    /// The type tag string of the frame message, including its leading ','
+    static constexpr std::array<char, arguments + 2> types = []()
+    {
+        std::array<char, arguments + 2> ret{};
+        ret[0] = ',';
+        for (std::size_t i = 0; i < size; ++i)
+            for (std::size_t n = 0; n < counts[i]; ++n)
+                ret[1 + indices[i] + n] = tags[i];
+        return ret;
+    }();
+    static constexpr auto path = []()
+    {
+        constexpr std::string_view suffix = "/frame";
+        if constexpr (has_name<Components>)
+        {
+            constexpr std::size_t name_size = name_length<Components>();
+            std::array<char, 1 + name_size + suffix.size() + 1> ret{};
+            ret[0] = '/';
+            std::copy_n(snake_case_v<Components>, name_size, ret.data() + 1);
+            std::copy_n(suffix.data(), suffix.size(), ret.data() + 1 + name_size);
+            return ret;
+        }
+        else
+        {
+            std::array<char, suffix.size() + 1> ret{};
+            std::copy_n(suffix.data(), suffix.size(), ret.data());
+            return ret;
+        }
+    }();
+
+    /// The length of the frame's address
+    static constexpr std::size_t path_length = path.size() - 1;
+    /// The offset of the first argument in the frame message
+    static constexpr std::size_t header_size = osc_string_size(path_length) + osc_string_size(arguments + 1);
+
+    /// The size of the frame message in bytes
+    static constexpr std::size_t message_size = header_size + 4 * arguments;
+
+    /// The offset of the argument with the given index in the frame message
+    static constexpr std::size_t offset(std::size_t index) { return header_size + 4 * index; }
+
+    /// The initial contents of the frame message, with all arguments set to zero
+    static constexpr std::array<char, message_size> initial_message = []()
+    {
+        std::array<char, message_size> ret{};
+        osc_writer out{ret};
+        out.string(path.data(), path_length);
+        out.string(types.data(), arguments + 1);
+        return ret;
+    }();
+
+    /// The frame message
+    std::array<char, message_size> message = initial_message;
+
+    /// Whether the frame has changed without having been reported by `update`
+    bool dirty = true;
+
+    /// Patch the current values of the frame's endpoints into the frame message, returning whether any changed
+    bool update(Components& components)
+    {
+        bool changed = dirty;
+        dirty = false;
+        [&]<typename ... Nodes>(boost::mp11::mp_list<Nodes...>)
+        {
+            std::size_t i = 0;
+            ((changed |= patch(Nodes::get(components), indices[i++])), ...);
+        }(nodes{});
+        return changed;
+    }
+
+    template<typename T>
+    bool patch(const T& endpoint, std::size_t index)
+    {
+        const float * deadband = nullptr;
+        const float * relative_deadband = nullptr;
+        if constexpr (has_deadband<T>) deadband = endpoint_deadband_v<T>.data();
+        if constexpr (has_relative_deadband<T>) relative_deadband = endpoint_relative_deadband_v<T>.data();
+        bool changed = false;
+        std::size_t element_index = 0;
+        auto patch_element = [&]<typename E>(const E& element)
+        {
+            std::size_t i = element_index++;
+            std::uint32_t bits;
+            if constexpr (std::integral<E>) bits = static_cast<std::uint32_t>(static_cast<std::int32_t>(element));
+            else bits = std::bit_cast<std::uint32_t>(static_cast<float>(element));
+            char * slot = message.data() + offset(index++);
+            std::uint32_t last = detail::osc_read_uint32(slot);
+            if (last == bits) return;
+            if (deadband || relative_deadband)
+            {
+                double previous;
+                if constexpr (std::integral<E>) previous = static_cast<std::int32_t>(last);
+                else previous = std::bit_cast<float>(last);
+                if (within_deadband(deadband, relative_deadband, i, static_cast<double>(element), previous)) return;
+            }
+            osc_writer{slot, 4}.uint32(bits);
+            changed = true;
+        };
+        if constexpr (array_like<value_t<T>>)
+            for (const auto& element : value_of(endpoint)) patch_element(element);
+        else patch_element(value_of(endpoint));
+        return changed;
+    }
+    template<typename Put>
+    static constexpr void write_schema(Put&& put)
+    {
+        auto string = [&](const char * s) { while (*s) put(*s++); };
+        auto number = [&](std::size_t n)
+        {
+            char digits[20]{};
+            std::size_t length = 0;
+            do digits[length++] = static_cast<char>('0' + n % 10); while (n /= 10);
+            while (length) put(digits[--length]);
+        };
+        string("{\"path\":\""); string(path.data());
+        string("\",\"types\":\""); string(types.data());
+        string("\",\"endpoints\":[");
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            if (i) put(',');
+            string("{\"path\":\""); string(paths[i]);
+            string("\",\"index\":"); number(indices[i]);
+            string(",\"count\":"); number(counts[i]);
+            string(",\"type\":\""); put(tags[i]);
+            string("\"}");
+        }
+        string("]}");
+    }
+
+    /// The length of the schema
+    static constexpr std::size_t schema_length = []()
+    {
+        std::size_t ret = 0;
+        write_schema([&](char) { ++ret; });
+        return ret;
+    }();
+
+    /// The schema of the frame, as a null terminated JSON string
+    static constexpr std::array<char, schema_length + 1> schema = []()
+    {
+        std::array<char, schema_length + 1> ret{};
+        std::size_t i = 0;
+        write_schema([&](char c) { ret[i++] = c; });
+        return ret;
+    }();
+    /// The address of the schema message
+    static constexpr auto schema_path = []()
+    {
+        constexpr std::string_view suffix = "/schema";
+        std::array<char, path_length + suffix.size() + 1> ret{};
+        std::copy_n(path.data(), path_length, ret.data());
+        std::copy_n(suffix.data(), suffix.size(), ret.data() + path_length);
+        return ret;
+    }();
+
+    /// An OSC message holding the schema of the frame
+    static constexpr auto schema_message = []()
+    {
+        constexpr std::size_t N = osc_string_size(schema_path.size() - 1) + 4 + osc_string_size(schema_length);
+        std::array<char, N> ret{};
+        osc_writer out{ret};
+        out.string(schema_path.data(), schema_path.size() - 1);
+        out.string(",s", 2);
+        out.string(schema.data(), schema_length);
+        return ret;
+    }();
+};
+
+///\}
+///\}
+} }
@@ -0,0 +1,121 @@
+/*
+Copyright 2026 Travis J. West, https://traviswest.ca, Input Devices and Music
+Interaction Laboratory (IDMIL), Centre for Interdisciplinary Research in Music
+Media and Technology (CIRMMT), McGill University, Montréal, Canada, and Univ.
+Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
+
+SPDX-License-Identifier: MIT
+*/
+
+#include <array>
+#include <cstring>
+#include <string_view>
+#include <catch2/catch_test_macros.hpp>
+#include "sygah-endpoints.hpp"
+#include "sygbp-test_component.hpp"
+#include "sygbp-osc_frame.hpp"
+
+using std::string_view;
+using namespace sygaldry;
+using namespace sygaldry::sygbp;
+
+static_assert(osc_frame_endpoint<slider<"s">>());
+static_assert(osc_frame_endpoint<toggle<"t">>());
+static_assert(osc_frame_endpoint<array<"a", 3>>());
+static_assert(not osc_frame_endpoint<button<"b">>());
+static_assert(not osc_frame_endpoint<bng<"b">>());
+static_assert(not osc_frame_endpoint<text<"t">>());
+static_assert(osc_argument_count<array<"a", 3>>() == 3);
+static_assert(osc_argument_count<slider<"s">>() == 1);
+struct frame_test_components
+{
+    TestComponent tc;
+};
+using frame = osc_frame<frame_test_components>;
+
+// toggle, slider, and array outputs
+static_assert(frame::size == 3);
+static_assert(frame::arguments == 5);
+static_assert(string_view(frame::path.data()) == "/frame");
+static_assert(string_view(frame::types.data()) == ",iffff");
+static_assert(frame::indices == std::array<std::size_t, 3>{0, 1, 2});
+static_assert(frame::header_size == 8 + 8);
+static_assert(frame::message_size == 16 + 20);
+static_assert(frame::offset(2) == 24);
+static_assert(frame::included[endpoint_registry<frame_test_components>::index_of<decltype(frame_test_components{}.tc.outputs.slider_out)>]);
+static_assert(not frame::included[endpoint_registry<frame_test_components>::index_of<decltype(frame_test_components{}.tc.inputs.slider_in)>]);
+
+static_assert(string_view(osc_frame<TestComponent>::path.data()) == "/Test_Component_1/frame");
+TEST_CASE("sygaldry osc_frame update")
+{
+    frame_test_components components{};
+    frame f{};
+    CHECK(std::memcmp(f.message.data(), "/frame\0\0,iffff\0\0", 16) == 0);
+    CHECK(f.update(components));
+    CHECK(not f.update(components));
+
+    components.tc.outputs.slider_out = 0.5f;
+    CHECK(f.update(components));
+    CHECK(not f.update(components));
+    CHECK(std::memcmp(f.message.data() + frame::offset(1), "\x3f\0\0\0", 4) == 0);
+
+    components.tc.outputs.toggle_out = 1;
+    components.tc.outputs.array_out = std::array<float, 3>{0.0f, -2.0f, 0.0f};
+    CHECK(f.update(components));
+    CHECK(std::memcmp(f.message.data() + frame::offset(0), "\0\0\0\1", 4) == 0);
+    CHECK(std::memcmp(f.message.data() + frame::offset(3), "\xc0\0\0\0", 4) == 0);
+
+    osc_message_view message{};
+    REQUIRE(osc_parse_message(f.message.data(), f.message.size(), message));
+    CHECK(string_view(message.path) == "/frame");
+    CHECK(string_view(message.types) == "iffff");
+    osc_argument_reader in{message};
+    std::int32_t i{};
+    float x{};
+    CHECK(in.read(i));
+    CHECK(i == 1);
+    CHECK(in.read(x));
+    CHECK(x == 0.5f);
+}
+
+struct frame_deadband_component : name_<"Frame Deadband"> {
+    struct inputs_t {} inputs;
+    struct outputs_t {
+        array<"xy", 2, "", float, -1.0f, 1.0f, 0.0f, deadband_<0.1f, 0.0f>> xy;
+    } outputs;
+};
+struct frame_deadband_components
+{
+    frame_deadband_component fd;
+};
+
+TEST_CASE("sygaldry osc_frame deadband")
+{
+    frame_deadband_components components{};
+    osc_frame<frame_deadband_components> f{};
+    CHECK(f.update(components));
+    components.fd.outputs.xy = std::array<float, 2>{0.05f, 0.0f};
+    CHECK(not f.update(components));
+    components.fd.outputs.xy = std::array<float, 2>{0.05f, 0.01f};
+    CHECK(f.update(components));
+    components.fd.outputs.xy = std::array<float, 2>{0.2f, 0.01f};
+    CHECK(f.update(components));
+    CHECK(std::bit_cast<float>(sygbp::detail::osc_read_uint32(f.message.data() + f.offset(0))) == 0.2f);
+}
+TEST_CASE("sygaldry osc_frame schema")
+{
+    CHECK(string_view(frame::schema.data()) ==
+        "{\"path\":\"/frame\",\"types\":\",iffff\",\"endpoints\":["
+        "{\"path\":\"/Test_Component_1/toggle_out\",\"index\":0,\"count\":1,\"type\":\"i\"},"
+        "{\"path\":\"/Test_Component_1/slider_out\",\"index\":1,\"count\":1,\"type\":\"f\"},"
+        "{\"path\":\"/Test_Component_1/array_out\",\"index\":2,\"count\":3,\"type\":\"f\"}"
+        "]}");
+
+    osc_message_view message{};
+    REQUIRE(osc_parse_message(frame::schema_message.data(), frame::schema_message.size(), message));
+    CHECK(string_view(message.path) == "/frame/schema");
+    CHECK(string_view(message.types) == "s");
+    const char * schema{};
+    CHECK(osc_argument_reader{message}.read(schema));
+    CHECK(string_view(schema) == string_view(frame::schema.data()));
+}
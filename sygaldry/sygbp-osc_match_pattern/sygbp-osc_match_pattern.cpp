@@ -7,91 +7,231 @@ Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
 SPDX-License-Identifier: MIT
 */
 #include "sygbp-osc_match_pattern.hpp"
+#include <bitset>
+#include <cstring>
+#include <utility>
 
-/// Match an OSC address pattern against the given address
-bool osc_match_pattern(const char * pattern, const char * address)
+namespace {
+using op = osc_compiled_pattern::op;
+constexpr unsigned char no_instruction = 0xff;
+
+bool emit(osc_compiled_pattern& out, op code, char c = 0, unsigned char alt = 0)
 {
-    switch (*pattern)
-    {
-    case '*':
-        while (*pattern == '*') ++pattern;
-        while (*address && *address != '/' && *address != *pattern) ++address;
-        return osc_match_pattern(pattern, address);
-    case '[':
+    const unsigned char size = out.size;
+    if (size >= osc_compiled_pattern::max_instructions) return false;
+    out.size = size + 1;
+    out.program[size] = {code, (unsigned char)(size + 1), alt, c};
+    return true;
+}
+}
+
+bool osc_compile_pattern(const char * pattern, osc_compiled_pattern& out)
+{
+    out.size = 0;
+    out.range_count = 0;
+    out.valid = false;
+    while (*pattern)
     {
-        bool negate = *++pattern == '!';
-        bool match = false;
-        while (not match)
+        switch (*pattern)
+        {
+        case '*':
+            while (*pattern == '*') ++pattern;
+            if (not emit(out, op::glob)) return false;
+            break;
+        case '[':
         {
-            if (*pattern == '\0') return false;
-            if (*pattern == ']') break;
-            if (*(pattern + 1) == '-' && (*(pattern + 2) && *(pattern + 2) != ']'))
+            op code = op::set;
+            if (*++pattern == '!')
             {
-                char start = *pattern;
-                char end = *(pattern + 2);
-                pattern = pattern + 3;
-                if (start < end) match = start <= *address && *address <= end;
-                else             match = end   <= *address && *address <= start;
+                code = op::inverted_set;
+                ++pattern;
             }
-            else if (*pattern++ == *address) match = true;
+            const unsigned char first = out.range_count;
+            while (*pattern != ']')
+            {
+                if (*pattern == '\0') return false;
+                if (out.range_count >= osc_compiled_pattern::max_ranges) return false;
+                char * range = out.ranges[out.range_count++];
+                if (*(pattern + 1) == '-' && (*(pattern + 2) && *(pattern + 2) != ']'))
+                {
+                    char start = *pattern;
+                    char end = *(pattern + 2);
+                    range[0] = start < end ? start : end;
+                    range[1] = start < end ? end : start;
+                    pattern = pattern + 3;
+                }
+                else range[0] = range[1] = *pattern++;
+            }
+            ++pattern;
+            if (not emit(out, code, (char)(out.range_count - first), first)) return false;
+            break;
         }
-        while (*pattern && *pattern != ']') ++pattern;
-        if (*pattern == '\0') return false;
-        if (negate) match = not match;
-        if (match) return osc_match_pattern(++pattern, ++address);
-        else return false;
-        break;
-    }
-    case '{':
-    {
-        ++pattern;
-        const char * address_start = address;
-        bool match = false;
-        while (not match)
+        case '{':
         {
-            if (*pattern == '\0') return false;
-            if (*pattern == '}') break;
-            if (*pattern++ == *address++)
+            if (*++pattern == '}')
             {
-                if (*pattern == ',' || *pattern == '}') match = true;
+                ++pattern;
+                if (not emit(out, op::set, 0, out.range_count)) return false;
+                break;
             }
-            else
+            unsigned char jumps = no_instruction;
+            for (;;)
             {
-                address = address_start;
-                while (*pattern && *pattern != '}' && *pattern != ',') ++pattern;
-                if (*pattern == ',') ++pattern;
+                const unsigned char split = out.size;
+                if (not emit(out, op::split)) return false;
+                while (*pattern != ',' && *pattern != '}')
+                {
+                    if (*pattern == '\0') return false;
+                    if (not emit(out, op::character, *pattern++)) return false;
+                }
+                if (not emit(out, op::jump, 0, jumps)) return false;
+                jumps = out.size - 1;
+                if (*pattern++ == '}')
+                {
+                    out.program[split].alt = split + 1;
+                    break;
+                }
+                out.program[split].alt = out.size;
+            }
+            while (jumps != no_instruction)
+            {
+                auto& jump = out.program[jumps];
+                jumps = jump.alt;
+                jump.next = out.size;
+            }
+            break;
+        }
+        case '/':
+            if (*(pattern + 1) == '/')
+            {
+                while (*pattern == '/') ++pattern;
+                if (not emit(out, op::character, '/')) return false;
+                const unsigned char split = out.size;
+                if (not emit(out, op::split, 0, split + 1)) return false;
+                if (not emit(out, op::segment)) return false;
+                out.program[split].next = split + 2;
+                out.program[split + 1].next = split;
+                break;
             }
+            [[fallthrough]];
+        default:
+            if (not emit(out, *pattern == '?' ? op::wildcard : op::character, *pattern)) return false;
+            ++pattern;
+            break;
         }
-        while (*pattern && *pattern != '}') ++pattern;
-        if (*pattern == '\0') return false;
-        if (match) return osc_match_pattern(++pattern, address);
-        else return false;
-        break;
     }
-    case '\0':
-        if (*address == '\0') return true;
-        break;
-    case '/':
-        if (*(pattern+1) != '/') /*fallthrough*/;
-        else
+    if (not emit(out, op::accept)) return false;
+    return out.valid = true;
+}
+
+namespace {
+struct state_set
+{
+    std::bitset<osc_compiled_pattern::max_instructions> contains;
+    unsigned char count;
+    unsigned char states[osc_compiled_pattern::max_instructions];
+
+    void clear()
+    {
+        contains.reset();
+        count = 0;
+    }
+
+    void add(unsigned char state)
+    {
+        if (contains[state]) return;
+        contains[state] = true;
+        states[count++] = state;
+    }
+};
+
+void add_state(const osc_compiled_pattern& pattern, state_set& set, unsigned char state)
+{
+    unsigned i = set.count;
+    set.add(state);
+    for (; i < set.count; ++i)
+    {
+        const auto& instruction = pattern.program[set.states[i]];
+        switch (instruction.code)
         {
-            ++pattern;
-            while (not osc_match_pattern(pattern, address))
+        case op::split:
+            set.add(instruction.next);
+            set.add(instruction.alt);
+            break;
+        case op::jump:
+        case op::glob:
+            set.add(instruction.next);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+bool in_set(const osc_compiled_pattern& pattern, const osc_compiled_pattern::instruction& instruction, char c)
+{
+    for (unsigned r = instruction.alt; r < instruction.alt + (unsigned char)instruction.c; ++r)
+        if (pattern.ranges[r][0] <= c && c <= pattern.ranges[r][1]) return true;
+    return false;
+}
+}
+
+bool osc_match_pattern(const osc_compiled_pattern& pattern, const char * address)
+{
+    if (not pattern.valid) return false;
+    unsigned char start = 0;
+    for (; pattern.program[start].code == op::character; ++start, ++address)
+        if (*address != pattern.program[start].c) return false;
+    if (pattern.program[start].code == op::glob && pattern.program[start].next == pattern.size - 1)
+        return std::strchr(address, '/') == nullptr;
+    state_set sets[2];
+    state_set * current = &sets[0];
+    state_set * next = &sets[1];
+    current->clear();
+    add_state(pattern, *current, start);
+    for (; *address; ++address)
+    {
+        const char c = *address;
+        next->clear();
+        for (unsigned i = 0; i < current->count; ++i)
+        {
+            const unsigned char s = current->states[i];
+            const auto& instruction = pattern.program[s];
+            switch (instruction.code)
             {
-                while (*address)
-                {
-                    ++address;
-                    if (*address == '/') break;
-                }
-                if (*address == '\0') return false;
+            case op::character:
+                if (c == instruction.c) add_state(pattern, *next, instruction.next);
+                break;
+            case op::wildcard:
+                if (c != '/') add_state(pattern, *next, instruction.next);
+                break;
+            case op::set:
+                if (in_set(pattern, instruction, c)) add_state(pattern, *next, instruction.next);
+                break;
+            case op::inverted_set:
+                if (c != '/' && not in_set(pattern, instruction, c)) add_state(pattern, *next, instruction.next);
+                break;
+            case op::glob:
+                if (c != '/') add_state(pattern, *next, s);
+                break;
+            case op::segment:
+                add_state(pattern, *next, c == '/' ? instruction.next : s);
+                break;
+            default:
+                break;
             }
-            return true;
         }
-        [[fallthrough]];
-    default:
-        if (*pattern == '?' || *pattern == *address) return osc_match_pattern(++pattern, ++address);
-        else return false;
-        break;
+        if (next->count == 0) return false;
+        std::swap(current, next);
     }
-    return false;
+    return current->contains[pattern.size - 1];
+}
+
+bool osc_match_pattern(const char * pattern, const char * address)
+{
+    if (not std::strpbrk(pattern, "*?[{") && not std::strstr(pattern, "//"))
+        return std::strcmp(pattern, address) == 0;
+    osc_compiled_pattern compiled;
+    if (not osc_compile_pattern(pattern, compiled)) return false;
+    return osc_match_pattern(compiled, address);
 }
@@ -12,6 +12,44 @@ SPDX-License-Identifier: MIT
 ///\{
 ///\defgroup sygbp-osc_match_pattern sygbp-osc_match_pattern: OSC Address Pattern Matching
 ///\{
+/// A compiled OSC address pattern; see osc_compile_pattern
+struct osc_compiled_pattern
+{
+    static constexpr unsigned max_instructions = 128;
+    static constexpr unsigned max_ranges = 64;
+    enum class op : unsigned char
+    {
+        character,    ///< match the character `c`
+        wildcard,     ///< match any character except `/`
+        set,          ///< match a character in `c` ranges starting at `ranges[alt]`
+        inverted_set, ///< match any character except `/` not in the ranges
+        glob,         ///< match zero or more characters except `/`
+        split,        ///< continue at both `next` and `alt`
+        jump,         ///< continue at `next`
+        segment,      ///< match one part of the address, continuing at `next` on `/`
+        accept,       ///< match the end of the address
+    };
+    struct instruction
+    {
+        op code;
+        unsigned char next;
+        unsigned char alt;
+        char c;
+    };
+    instruction program[max_instructions];
+    char ranges[max_ranges][2];
+    unsigned char size = 0;
+    unsigned char range_count = 0;
+    bool valid = false;
+};
+
+/// Compile an OSC address pattern, returning false if the pattern is invalid
+bool osc_compile_pattern(const char * pattern, osc_compiled_pattern& out);
+
+/// Match a compiled OSC address pattern against the given address
+bool osc_match_pattern(const osc_compiled_pattern& pattern, const char * address);
+
+/// Match an OSC address pattern against the given address
 bool osc_match_pattern(const char * pattern, const char * address);
 ///\}
 ///\}
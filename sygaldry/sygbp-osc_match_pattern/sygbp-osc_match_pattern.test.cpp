@@ -7,15 +7,70 @@ Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
 SPDX-License-Identifier: MIT
 */
 
+#include <cstring>
 #include <catch2/catch_test_macros.hpp>
 #include "sygbp-osc_match_pattern.hpp"
 
+TEST_CASE("sygaldry OSC compile pattern")
+{
+    osc_compiled_pattern pattern;
+    CHECK(osc_compile_pattern("/Trill_Craft/*", pattern));
+    CHECK(pattern.valid);
+    CHECK(osc_match_pattern(pattern, "/Trill_Craft/speed"));
+    CHECK(osc_match_pattern(pattern, "/Trill_Craft/prescaler"));
+    CHECK(not osc_match_pattern(pattern, "/Button/any"));
+
+    CHECK(not osc_compile_pattern("/[12323", pattern));
+    CHECK(not pattern.valid);
+    CHECK(not osc_match_pattern(pattern, "/323"));
+
+    char too_long[2 * osc_compiled_pattern::max_instructions] = {};
+    for (auto& c : too_long) c = '?';
+    too_long[0] = '/';
+    too_long[sizeof(too_long) - 1] = '\0';
+    CHECK(not osc_compile_pattern(too_long, pattern));
+}
+TEST_CASE("sygaldry OSC match pattern rejects patterns too long to compile")
+{
+    osc_compiled_pattern compiled;
+
+    char wildcards[2 * osc_compiled_pattern::max_instructions] = {};
+    char address[sizeof(wildcards)] = {};
+    for (std::size_t i = 0; i < sizeof(wildcards) - 1; ++i)
+    {
+        wildcards[i] = '?';
+        address[i] = 'a';
+    }
+    wildcards[0] = address[0] = '/';
+    CHECK(not osc_compile_pattern(wildcards, compiled));
+    CHECK(not compiled.valid);
+    CHECK(not osc_match_pattern(compiled, address));
+    CHECK(not osc_match_pattern(wildcards, address));
+    wildcards[osc_compiled_pattern::max_instructions / 2] = address[osc_compiled_pattern::max_instructions / 2] = '\0';
+    CHECK(osc_compile_pattern(wildcards, compiled));
+    CHECK(osc_match_pattern(wildcards, address));
+
+    char sets[3 * (osc_compiled_pattern::max_ranges + 1) + 2] = "/";
+    char letters[osc_compiled_pattern::max_ranges + 3] = "/";
+    for (std::size_t i = 0; i <= osc_compiled_pattern::max_ranges; ++i)
+    {
+        std::strcat(sets, "[a]");
+        std::strcat(letters, "a");
+    }
+    CHECK(not osc_compile_pattern(sets, compiled));
+    CHECK(not osc_match_pattern(sets, letters));
+}
 TEST_CASE("sygaldry OSC match wildcards")
 {
     CHECK(osc_match_pattern("/???", "/123"));
     CHECK(osc_match_pattern("/foo.?", "/foo.8"));
     CHECK(not osc_match_pattern("/foo.?", "/foo.42"));
 }
+TEST_CASE("sygaldry OSC match wildcards do not match separators")
+{
+    CHECK(not osc_match_pattern("/?", "//"));
+    CHECK(not osc_match_pattern("/a?b", "/a/b"));
+}
 TEST_CASE("sygaldry OSC match globs")
 {
     CHECK(osc_match_pattern("/*", "/123"));
@@ -31,6 +86,16 @@ TEST_CASE("sygaldry OSC match globs")
     CHECK(not osc_match_pattern("/*/*", "/banana"));
     CHECK(not osc_match_pattern("/banana/*", "/apple/pie"));
 }
+TEST_CASE("sygaldry OSC match globs without backtracking")
+{
+    CHECK(osc_match_pattern("/*_in", "/text_message_in"));
+    CHECK(osc_match_pattern("/*a", "/banana"));
+    CHECK(osc_match_pattern("/*.*", "/a.b.c"));
+    CHECK(not osc_match_pattern("/*_in", "/text_message_out"));
+
+    // pathological for a backtracking matcher
+    CHECK(not osc_match_pattern("/*a*a*a*a*a*a*a*a*b", "/aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"));
+}
 TEST_CASE("sygaldry OSC match sets")
 {
     CHECK(osc_match_pattern("/[123]23", "/123"));
@@ -87,6 +152,14 @@ TEST_CASE("sygaldry OSC match substrings")
     CHECK(not osc_match_pattern("/{apple,banana,blueberry}}/pie", "/banana/pie"));
     CHECK(not osc_match_pattern("/{apple,banana,blueberry/pie", "/banana/pie"));
 }
+TEST_CASE("sygaldry OSC match substrings without backtracking")
+{
+    CHECK(osc_match_pattern("/{a,ab}c", "/abc"));
+    CHECK(osc_match_pattern("/{a,ab}c", "/ac"));
+    CHECK(osc_match_pattern("/x{,y}z", "/xz"));
+    CHECK(osc_match_pattern("/x{,y}z", "/xyz"));
+    CHECK(not osc_match_pattern("/x{}z", "/xz"));
+}
 TEST_CASE("sygaldry OSC match regular")
 {
     CHECK(osc_match_pattern("/sugar/pie", "/sugar/pie"));
@@ -0,0 +1,374 @@
+#pragma once
+/*
+Copyright 2026 Travis J. West, https://traviswest.ca, Input Devices and Music
+Interaction Laboratory (IDMIL), Centre for Interdisciplinary Research in Music
+Media and Technology (CIRMMT), McGill University, Montréal, Canada, and Univ.
+Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
+
+SPDX-License-Identifier: MIT
+*/
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include "sygac-endpoints.hpp"
+#include "sygac-components.hpp"
+#include "sygbp-osc_string_constants.hpp"
+
+namespace sygaldry { namespace sygbp {
+///\addtogroup sygbp
+///\{
+///\defgroup sygbp-osc_packet sygbp-osc_packet: OSC Packet Encoding and Decoding
+///\{
+
+/// The OSC time tag meaning that a bundle should be handled immediately
+inline constexpr std::uint64_t osc_immediately = 1;
+
+/// The size of a block of `n` bytes padded to a multiple of 4 bytes
+constexpr std::size_t osc_padded_size(std::size_t n) { return (n + 3) & ~std::size_t(3); }
+
+/// The size of an OSC string with the given length, including its null terminator and padding
+constexpr std::size_t osc_string_size(std::size_t length) { return osc_padded_size(length + 1); }
+
+/// The string at the start of every OSC bundle, including its null terminator
+inline constexpr char osc_bundle_tag[8] = {'#', 'b', 'u', 'n', 'd', 'l', 'e', '\0'};
+
+/// Writes OSC data into a caller-provided buffer without allocating
+struct osc_writer
+{
+    char * buffer; ///< The start of the buffer
+    std::size_t capacity; ///< The size of the buffer in bytes
+    std::size_t length = 0; ///< The number of bytes written so far
+    bool overflow = false; ///< Whether a write has failed for lack of space
+
+    constexpr osc_writer(char * b, std::size_t c) : buffer{b}, capacity{c} {}
+
+    template<std::size_t N>
+    constexpr osc_writer(std::array<char, N>& b) : buffer{b.data()}, capacity{N} {}
+
+    /// Discard everything written so far
+    constexpr void reset() { rewind(0); }
+
+    /// Discard everything written since `length` was equal to `position`
+    constexpr void rewind(std::size_t position)
+    {
+        length = position;
+        overflow = false;
+    }
+
+    /// Check that `n` more bytes fit in the buffer, setting the `overflow` flag if they don't
+    constexpr bool reserve(std::size_t n)
+    {
+        if (overflow || capacity - length < n) overflow = true;
+        return not overflow;
+    }
+
+    constexpr void uint32(std::uint32_t i)
+    {
+        if (not reserve(4)) return;
+        buffer[length++] = static_cast<char>(i >> 24);
+        buffer[length++] = static_cast<char>(i >> 16);
+        buffer[length++] = static_cast<char>(i >> 8);
+        buffer[length++] = static_cast<char>(i);
+    }
+
+    constexpr void int32(std::int32_t i) { uint32(static_cast<std::uint32_t>(i)); }
+
+    constexpr void float32(float f) { uint32(std::bit_cast<std::uint32_t>(f)); }
+
+    constexpr void timetag(std::uint64_t t)
+    {
+        uint32(static_cast<std::uint32_t>(t >> 32));
+        uint32(static_cast<std::uint32_t>(t));
+    }
+
+    /// Write `n` bytes of `data` that are already padded to a multiple of 4 bytes
+    constexpr void padded(const char * data, std::size_t n)
+    {
+        if (not reserve(n)) return;
+        std::copy_n(data, n, buffer + length);
+        length += n;
+    }
+
+    /// Write a string of the given length, adding its null terminator and padding
+    constexpr void string(const char * s, std::size_t n)
+    {
+        const std::size_t size = osc_string_size(n);
+        if (not reserve(size)) return;
+        std::copy_n(s, n, buffer + length);
+        std::fill_n(buffer + length + n, size - n, '\0');
+        length += size;
+    }
+
+    constexpr void string(const char * s) { string(s, std::char_traits<char>::length(s)); }
+
+    /// Write the header of a bundle with the given time tag
+    constexpr void bundle(std::uint64_t t = osc_immediately)
+    {
+        padded(osc_bundle_tag, sizeof(osc_bundle_tag));
+        timetag(t);
+    }
+
+    /// Leave space for the size of a bundle element, returning its position for `end_element`
+    constexpr std::size_t begin_element()
+    {
+        const std::size_t position = length;
+        uint32(0);
+        return position;
+    }
+
+    /// Fill in the size of the bundle element begun at `position`
+    constexpr void end_element(std::size_t position)
+    {
+        if (overflow) return;
+        const auto size = static_cast<std::uint32_t>(length - position - 4);
+        buffer[position + 0] = static_cast<char>(size >> 24);
+        buffer[position + 1] = static_cast<char>(size >> 16);
+        buffer[position + 2] = static_cast<char>(size >> 8);
+        buffer[position + 3] = static_cast<char>(size);
+    }
+};
+
+template<typename E>
+constexpr void osc_encode_element(osc_writer& out, const E& element)
+{
+    if constexpr (std::integral<E>) out.int32(static_cast<std::int32_t>(element));
+    else if constexpr (std::floating_point<E>) out.float32(static_cast<float>(element));
+    else if constexpr (requires {element.c_str(); element.size();}) out.string(element.c_str(), element.size());
+    else out.string(element);
+}
+
+/// Write an OSC message with the address, type tags, and value of `endpoint`, returning whether it fit
+template<typename Components, typename T>
+constexpr bool osc_encode_message(osc_writer& out, const T& endpoint)
+{
+    using path = osc_path<path_t<T, Components>>;
+    using type_string = osc_type_string<T>;
+    out.string(path::value.data(), path::N - 1);
+    out.padded(type_string::value.data(), type_string::N);
+    if constexpr (Bang<T>) return not out.overflow;
+    else if constexpr (array_like<value_t<T>>)
+    {
+        for (const auto& element : value_of(endpoint)) osc_encode_element(out, element);
+    }
+    else osc_encode_element(out, value_of(endpoint));
+    return not out.overflow;
+}
+
+/// Write the message for `endpoint` as an element of a bundle, discarding it if it doesn't fit
+template<typename Components, typename T>
+constexpr bool osc_encode_bundle_message(osc_writer& out, const T& endpoint)
+{
+    const std::size_t position = out.begin_element();
+    if (osc_encode_message<Components>(out, endpoint))
+    {
+        out.end_element(position);
+        return true;
+    }
+    out.rewind(position);
+    out.overflow = true;
+    return false;
+}
+
+/// An OSC message that has been parsed in place
+struct osc_message_view
+{
+    const char * path; ///< The address of the message
+    const char * types; ///< The type tags of the message's arguments, without the leading ','
+    const char * arguments; ///< The start of the message's arguments
+    const char * end; ///< The end of the message
+};
+
+namespace detail {
+/// Find the end of the padded string at `s`, or return null if it isn't terminated before `end`
+constexpr const char * osc_string_end(const char * s, const char * end)
+{
+    for (const char * c = s; c < end; ++c)
+        if (*c == '\0')
+        {
+            std::size_t size = osc_string_size(c - s);
+            if (size > static_cast<std::size_t>(end - s)) return nullptr;
+            return s + size;
+        }
+    return nullptr;
+}
+
+constexpr std::uint32_t osc_read_uint32(const char * data)
+{
+    return static_cast<std::uint32_t>(static_cast<unsigned char>(data[0])) << 24
+         | static_cast<std::uint32_t>(static_cast<unsigned char>(data[1])) << 16
+         | static_cast<std::uint32_t>(static_cast<unsigned char>(data[2])) << 8
+         | static_cast<std::uint32_t>(static_cast<unsigned char>(data[3]));
+}
+}
+
+/// Parse the OSC message in the buffer at `data`, returning whether it is well formed
+constexpr bool osc_parse_message(const char * data, std::size_t size, osc_message_view& out)
+{
+    const char * end = data + size;
+    if (size == 0 || size % 4 != 0 || *data != '/') return false;
+    const char * types = detail::osc_string_end(data, end);
+    if (types == nullptr) return false;
+    out.path = data;
+    out.end = end;
+    if (types == end) // messages without type tags are permitted to have no arguments
+    {
+        out.types = types - 1; // the null terminator of the path
+        out.arguments = end;
+        return true;
+    }
+    if (*types != ',') return false;
+    const char * arguments = detail::osc_string_end(types, end);
+    if (arguments == nullptr) return false;
+    out.types = types + 1;
+    out.arguments = arguments;
+    return true;
+}
+
+/// Reads the arguments of an OSC message in order
+struct osc_argument_reader
+{
+    const char * types;
+    const char * data;
+    const char * end;
+
+    constexpr osc_argument_reader(const osc_message_view& message)
+    : types{message.types}, data{message.arguments}, end{message.end} {}
+
+    /// The type tag of the next argument, or '\0' if there are none left
+    constexpr char type() const { return *types; }
+
+    constexpr bool read(std::int32_t& out)
+    {
+        if (*types != 'i' || end - data < 4) return false;
+        out = static_cast<std::int32_t>(detail::osc_read_uint32(data));
+        ++types;
+        data += 4;
+        return true;
+    }
+
+    constexpr bool read(float& out)
+    {
+        if (*types != 'f' || end - data < 4) return false;
+        out = std::bit_cast<float>(detail::osc_read_uint32(data));
+        ++types;
+        data += 4;
+        return true;
+    }
+
+    constexpr bool read(std::uint64_t& out)
+    {
+        if (*types != 't' || end - data < 8) return false;
+        out = static_cast<std::uint64_t>(detail::osc_read_uint32(data)) << 32
+            | detail::osc_read_uint32(data + 4);
+        ++types;
+        data += 8;
+        return true;
+    }
+
+    constexpr bool read(const char *& out)
+    {
+        if (*types != 's') return false;
+        const char * next = detail::osc_string_end(data, end);
+        if (next == nullptr) return false;
+        out = data;
+        ++types;
+        data = next;
+        return true;
+    }
+};
+
+/// The maximum depth of nested bundles accepted by osc_parse_packet
+inline constexpr unsigned osc_max_bundle_depth = 8;
+
+/// Call `f(message, timetag)` for every message in the OSC packet at `data`, returning whether the packet is well formed
+template<typename F>
+constexpr bool osc_parse_packet( const char * data, std::size_t size, F&& f
+                               , std::uint64_t timetag = osc_immediately
+                               , unsigned depth = 0
+                               )
+{
+    if (size < sizeof(osc_bundle_tag) || std::char_traits<char>::compare(data, osc_bundle_tag, sizeof(osc_bundle_tag)) != 0)
+    {
+        osc_message_view message{};
+        if (not osc_parse_message(data, size, message)) return false;
+        f(message, timetag);
+        return true;
+    }
+    if (depth >= osc_max_bundle_depth || size < 16) return false;
+    timetag = static_cast<std::uint64_t>(detail::osc_read_uint32(data + 8)) << 32
+            | detail::osc_read_uint32(data + 12);
+    const char * element = data + 16;
+    const char * end = data + size;
+    while (element < end)
+    {
+        if (end - element < 4) return false;
+        const std::size_t element_size = detail::osc_read_uint32(element);
+        element += 4;
+        if (element_size > static_cast<std::size_t>(end - element)) return false;
+        if (not osc_parse_packet(element, element_size, f, timetag, depth + 1)) return false;
+        element += element_size;
+    }
+    return true;
+}
+
+namespace detail {
+template<typename E>
+constexpr bool osc_decode_element(osc_argument_reader& in, E& element)
+{
+    if constexpr (std::integral<E>)
+    {
+        std::int32_t i{};
+        if (not in.read(i)) return false;
+        element = static_cast<E>(i);
+    }
+    else if constexpr (std::floating_point<E>)
+    {
+        float f{};
+        if (not in.read(f)) return false;
+        element = static_cast<E>(f);
+    }
+    else
+    {
+        const char * s{};
+        if (not in.read(s)) return false;
+        element = s;
+    }
+    return true;
+}
+}
+
+/// Set the value of `endpoint` from the arguments of `message`, returning whether they were well typed
+template<typename T>
+constexpr bool osc_decode_value(const osc_message_view& message, T& endpoint)
+{
+    if (std::string_view{message.types} != std::string_view{osc_type_string_v<T>}.substr(1)) return false;
+    osc_argument_reader in{message};
+    if constexpr (Bang<T>)
+    {
+        endpoint = true;
+    }
+    else if constexpr (array_like<value_t<T>>)
+    {
+        value_t<T> value = value_of(endpoint);
+        for (auto& element : value)
+            if (not detail::osc_decode_element(in, element)) return false;
+        value_of(endpoint) = value;
+        if constexpr (UpdatedFlag<T>) endpoint.updated = true;
+    }
+    else
+    {
+        element_t<T> value{};
+        if (not detail::osc_decode_element(in, value)) return false;
+        set_value(endpoint, value);
+    }
+    return true;
+}
+
+///\}
+///\}
+} }
@@ -0,0 +1,238 @@
+/*
+Copyright 2026 Travis J. West, https://traviswest.ca, Input Devices and Music
+Interaction Laboratory (IDMIL), Centre for Interdisciplinary Research in Music
+Media and Technology (CIRMMT), McGill University, Montréal, Canada, and Univ.
+Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
+
+SPDX-License-Identifier: MIT
+*/
+
+#include <array>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include "sygbp-test_component.hpp"
+#include "sygbp-osc_packet.hpp"
+
+using std::string_view;
+using namespace sygaldry;
+using namespace sygaldry::sygbp;
+
+struct packet_test_components
+{
+    TestComponent tc;
+};
+
+static_assert(osc_padded_size(0) == 0);
+static_assert(osc_padded_size(1) == 4);
+static_assert(osc_padded_size(4) == 4);
+static_assert(osc_string_size(0) == 4);
+static_assert(osc_string_size(3) == 4);
+static_assert(osc_string_size(4) == 8);
+TEST_CASE("sygaldry osc_writer")
+{
+    std::array<char, 32> buffer{};
+    osc_writer out{buffer};
+    out.string("/foo");
+    out.string(",if");
+    out.int32(-2);
+    out.float32(1.0f);
+    CHECK(not out.overflow);
+    CHECK(out.length == 20);
+    CHECK(std::memcmp(buffer.data(), "/foo\0\0\0\0,if\0\xff\xff\xff\xfe\x3f\x80\0\0", 20) == 0);
+
+    out.string("/too/long/for/the/rest/of/the/buffer");
+    CHECK(out.overflow);
+    CHECK(out.length == 20);
+    out.int32(1);
+    CHECK(out.length == 20);
+
+    out.rewind(8);
+    CHECK(not out.overflow);
+    CHECK(out.length == 8);
+}
+TEST_CASE("sygaldry osc_encode_message")
+{
+    packet_test_components components{};
+    std::array<char, 128> buffer{};
+    osc_writer out{buffer};
+
+    components.tc.outputs.slider_out = 0.5f;
+    CHECK(osc_encode_message<packet_test_components>(out, components.tc.outputs.slider_out));
+    CHECK(out.length == 40);
+    CHECK(std::memcmp(buffer.data(), "/Test_Component_1/slider_out\0\0\0\0,f\0\0\x3f\0\0\0", 40) == 0);
+
+    out.reset();
+    components.tc.outputs.text_out = "hi";
+    CHECK(osc_encode_message<packet_test_components>(out, components.tc.outputs.text_out));
+    CHECK(out.length == 36);
+    CHECK(std::memcmp(buffer.data() + 28, ",s\0\0hi\0\0", 8) == 0);
+
+    out.reset();
+    CHECK(osc_encode_message<packet_test_components>(out, components.tc.outputs.array_out));
+    CHECK(out.length == 28 + 8 + 12);
+    CHECK(std::memcmp(buffer.data() + 28, ",fff\0\0\0\0", 8) == 0);
+
+    out.reset();
+    CHECK(osc_encode_message<packet_test_components>(out, components.tc.outputs.bang_out));
+    CHECK(out.length == 28 + 4);
+
+    std::array<char, 16> small{};
+    osc_writer short_out{small};
+    CHECK(not osc_encode_message<packet_test_components>(short_out, components.tc.outputs.bang_out));
+}
+
+TEST_CASE("sygaldry osc_encode_bundle_message")
+{
+    packet_test_components components{};
+    std::array<char, 100> buffer{};
+    osc_writer out{buffer};
+    out.bundle(0x0102030405060708);
+    CHECK(out.length == 16);
+    CHECK(osc_encode_bundle_message<packet_test_components>(out, components.tc.outputs.slider_out));
+    CHECK(out.length == 16 + 4 + 40);
+    CHECK(sygbp::detail::osc_read_uint32(buffer.data() + 16) == 40);
+    CHECK(not osc_encode_bundle_message<packet_test_components>(out, components.tc.outputs.array_out));
+    CHECK(out.overflow);
+    CHECK(out.length == 60);
+}
+TEST_CASE("sygaldry osc_parse_packet")
+{
+    packet_test_components components{};
+    components.tc.outputs.slider_out = 0.75f;
+    components.tc.outputs.text_out = "text";
+    std::array<char, 256> buffer{};
+    osc_writer out{buffer};
+    std::vector<std::string> paths{};
+    std::vector<std::uint64_t> timetags{};
+    auto collect = [&](const osc_message_view& message, std::uint64_t timetag)
+    {
+        paths.emplace_back(message.path);
+        timetags.push_back(timetag);
+    };
+
+    SECTION("message")
+    {
+        osc_encode_message<packet_test_components>(out, components.tc.outputs.slider_out);
+        CHECK(osc_parse_packet(buffer.data(), out.length, collect));
+        CHECK(paths == std::vector<std::string>{"/Test_Component_1/slider_out"});
+        CHECK(timetags == std::vector<std::uint64_t>{osc_immediately});
+
+        osc_message_view message{};
+        REQUIRE(osc_parse_message(buffer.data(), out.length, message));
+        CHECK(string_view(message.types) == "f");
+        osc_argument_reader in{message};
+        std::int32_t i{};
+        float f{};
+        CHECK(in.type() == 'f');
+        CHECK(not in.read(i));
+        CHECK(in.read(f));
+        CHECK(f == 0.75f);
+        CHECK(in.type() == '\0');
+        CHECK(not in.read(f));
+    }
+
+    SECTION("time tag arguments")
+    {
+        out.string("/t");
+        out.string(",t");
+        out.timetag(0x0123456789abcdefull);
+        osc_message_view message{};
+        REQUIRE(osc_parse_message(buffer.data(), out.length, message));
+        osc_argument_reader in{message};
+        std::uint64_t t{};
+        CHECK(in.read(t));
+        CHECK(t == 0x0123456789abcdefull);
+        CHECK(not in.read(t));
+    }
+
+    SECTION("nested bundles")
+    {
+        out.bundle(42);
+        osc_encode_bundle_message<packet_test_components>(out, components.tc.outputs.slider_out);
+        auto inner = out.begin_element();
+        out.bundle(43);
+        osc_encode_bundle_message<packet_test_components>(out, components.tc.outputs.text_out);
+        out.end_element(inner);
+        osc_encode_bundle_message<packet_test_components>(out, components.tc.outputs.bang_out);
+        REQUIRE(not out.overflow);
+        CHECK(osc_parse_packet(buffer.data(), out.length, collect));
+        CHECK(paths == std::vector<std::string>
+              { "/Test_Component_1/slider_out"
+              , "/Test_Component_1/text_out"
+              , "/Test_Component_1/bang_out"
+              });
+        CHECK(timetags == std::vector<std::uint64_t>{42, 43, 42});
+    }
+
+    SECTION("malformed")
+    {
+        osc_message_view message{};
+        CHECK(not osc_parse_message("/foo", 4, message)); // unterminated address
+        REQUIRE(osc_parse_message("/foo\0\0\0\0,f\0\0", 12, message)); // well formed, but missing its argument
+        float f{};
+        CHECK(not osc_argument_reader{message}.read(f));
+        CHECK(not osc_parse_message("/foo\0\0\0\0if\0\0", 12, message)); // type tags without comma
+        CHECK(not osc_parse_message("foo\0", 4, message)); // no leading slash
+        CHECK(not osc_parse_message("/fo\0\0", 5, message)); // size not a multiple of 4
+
+        out.bundle();
+        osc_encode_bundle_message<packet_test_components>(out, components.tc.outputs.slider_out);
+        buffer[19] += 4; // element size past the end of the packet
+        CHECK(not osc_parse_packet(buffer.data(), out.length, collect));
+        buffer[19] -= 5; // element size not a multiple of 4
+        CHECK(not osc_parse_packet(buffer.data(), out.length, collect));
+        CHECK(paths.empty());
+    }
+}
+TEST_CASE("sygaldry osc_decode_value")
+{
+    packet_test_components components{};
+    auto& in = components.tc.inputs;
+    auto& out = components.tc.outputs;
+    out.slider_out = 0.25f;
+    out.toggle_out = 1;
+    out.text_out = "hello";
+    out.array_out = std::array<float, 3>{1.0f, 2.0f, 3.0f};
+
+    std::array<char, 64> buffer{};
+    osc_writer writer{buffer};
+    osc_message_view message{};
+    auto encode = [&](const auto& endpoint)
+    {
+        writer.reset();
+        osc_encode_message<packet_test_components>(writer, endpoint);
+        return osc_parse_message(buffer.data(), writer.length, message);
+    };
+
+    REQUIRE(encode(out.slider_out));
+    CHECK(osc_decode_value(message, in.slider_in));
+    CHECK(in.slider_in == 0.25f);
+    CHECK(not osc_decode_value(message, in.text_in));
+    CHECK(not osc_decode_value(message, in.bang_in));
+    CHECK(not osc_decode_value(message, in.array_in));
+
+    REQUIRE(encode(out.toggle_out));
+    CHECK(osc_decode_value(message, in.toggle_in));
+    CHECK(in.toggle_in == 1);
+
+    REQUIRE(encode(out.text_out));
+    CHECK(osc_decode_value(message, in.text_in));
+    CHECK(in.text_in.value == "hello");
+
+    REQUIRE(encode(out.array_out));
+    CHECK(osc_decode_value(message, in.array_in));
+    CHECK(in.array_in.value == std::array<float, 3>{1.0f, 2.0f, 3.0f});
+
+    REQUIRE(encode(out.bang_out));
+    CHECK(osc_decode_value(message, in.bang_in));
+    CHECK(bool(in.bang_in));
+
+    // a message without type tags is accepted only by bangs
+    constexpr char untyped[] = "/bang\0\0";
+    REQUIRE(osc_parse_message(untyped, 8, message));
+    CHECK(string_view(message.types) == "");
+    CHECK(not osc_decode_value(message, in.slider_in));
+}
@@ -0,0 +1,232 @@
+#pragma once
+/*
+Copyright 2026 Travis J. West, https://traviswest.ca, Input Devices and Music
+Interaction Laboratory (IDMIL), Centre for Interdisciplinary Research in Music
+Media and Technology (CIRMMT), McGill University, Montréal, Canada, and Univ.
+Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
+
+SPDX-License-Identifier: MIT
+*/
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <boost/mp11.hpp>
+#include "sygac-metadata.hpp"
+#include "sygac-components.hpp"
+#include "sygbp-osc_string_constants.hpp"
+#include "sygbp-osc_match_pattern.hpp"
+
+namespace sygaldry { namespace sygbp {
+///\addtogroup sygbp
+///\{
+///\defgroup sygbp-osc_path_trie sygbp-osc_path_trie: OSC Path Trie
+///\{
+
+/// Sentinel value for missing nodes and entities in an OSC path trie
+inline constexpr std::uint16_t trie_none = 0xffff;
+
+/// A node of an OSC path trie
+struct trie_node
+{
+    std::uint16_t segment = 0; ///< The offset of the node's segment in the trie's character array
+    std::uint16_t first_child = trie_none; ///< The index of the node's first child
+    std::uint16_t next_sibling = trie_none; ///< The index of the node's next sibling
+    std::uint16_t entity = trie_none; ///< The first entity whose address ends at this node
+};
+
+/// The nodes and segments of an OSC path trie, and the next entity with the same address as each entity
+template<std::size_t Nodes, std::size_t Chars, std::size_t Entities>
+struct trie_table
+{
+    std::array<trie_node, Nodes> nodes{};
+    std::array<char, Chars> chars{};
+    std::array<std::uint16_t, Entities> next_same{};
+    std::size_t node_count = 1;
+    std::size_t char_count = 1;
+};
+
+template<std::size_t Nodes, std::size_t Chars, std::size_t Entities>
+constexpr trie_table<Nodes, Chars, Entities> build_trie(const std::array<std::string_view, Entities>& paths)
+{
+    trie_table<Nodes, Chars, Entities> ret{};
+    ret.next_same.fill(trie_none);
+    auto segment_of = [&](std::size_t node)
+    {
+        return std::string_view(ret.chars.data() + ret.nodes[node].segment);
+    };
+    for (std::size_t e = 0; e < Entities; ++e)
+    {
+        std::string_view path = paths[e];
+        std::size_t node = 0;
+        while (path.size() > 1 && path[0] == '/')
+        {
+            path.remove_prefix(1);
+            auto segment = path.substr(0, path.find('/'));
+            path.remove_prefix(segment.size());
+
+            std::size_t child = ret.nodes[node].first_child;
+            std::size_t last = trie_none;
+            while (child != trie_none && segment_of(child) != segment)
+            {
+                last = child;
+                child = ret.nodes[child].next_sibling;
+            }
+            if (child == trie_none)
+            {
+                child = ret.node_count++;
+                ret.nodes[child].segment = static_cast<std::uint16_t>(ret.char_count);
+                for (char c : segment) ret.chars[ret.char_count++] = c;
+                ret.chars[ret.char_count++] = '\0';
+                if (last == trie_none) ret.nodes[node].first_child = static_cast<std::uint16_t>(child);
+                else ret.nodes[last].next_sibling = static_cast<std::uint16_t>(child);
+            }
+            node = child;
+        }
+        if (node == 0) continue;
+        if (ret.nodes[node].entity == trie_none)
+            ret.nodes[node].entity = static_cast<std::uint16_t>(e);
+        else
+        {
+            std::size_t same = ret.nodes[node].entity;
+            while (ret.next_same[same] != trie_none) same = ret.next_same[same];
+            ret.next_same[same] = static_cast<std::uint16_t>(e);
+        }
+    }
+    return ret;
+}
+
+/*! \brief A trie of the OSC addresses of the named entities in a component container of type `Components`
+
+\details Use `match` or `for_each_match` to find the entities whose address
+matches an OSC address pattern, pruning every subtree of the component
+tree whose address doesn't match a prefix of the pattern.
+*/
+template<typename Components>
+struct osc_path_trie
+{
+    template<typename Node>
+    using is_named_node = boost::mp11::mp_bool<has_name<typename Node::type>>;
+
+    /// The entries of the named entities in the node index of the container
+    using entities = boost::mp11::mp_copy_if<node_index_t<Components>, is_named_node>;
+
+    /// The number of named entities in the container
+    static constexpr std::size_t size = boost::mp11::mp_size<entities>::value;
+    static_assert(size < trie_none, "osc_path_trie: too many entities");
+
+    /// The OSC addresses of the entities, in tree order
+    static constexpr std::array<const char *, size> paths = []<typename ... Nodes>(boost::mp11::mp_list<Nodes...>)
+    {
+        return std::array<const char *, size>{osc_path_v<typename Nodes::type, Components>...};
+    }(entities{});
+
+    static constexpr std::array<std::string_view, size> path_views = []()
+    {
+        std::array<std::string_view, size> ret{};
+        for (std::size_t i = 0; i < size; ++i) ret[i] = paths[i];
+        return ret;
+    }();
+
+    static constexpr std::size_t max_nodes = []()
+    {
+        std::size_t ret = 1;
+        for (auto path : path_views) for (char c : path) ret += c == '/';
+        return ret;
+    }();
+
+    static constexpr std::size_t max_chars = []()
+    {
+        std::size_t ret = 1;
+        for (auto path : path_views) ret += path.size() + 1;
+        return ret;
+    }();
+
+    static constexpr auto sizes = []()
+    {
+        auto trie = build_trie<max_nodes, max_chars, size>(path_views);
+        return std::array<std::size_t, 2>{trie.node_count, trie.char_count};
+    }();
+    static_assert(sizes[1] < trie_none, "osc_path_trie: too many characters");
+
+    /// The trie
+    static constexpr auto table = build_trie<sizes[0], sizes[1], size>(path_views);
+
+    /// The maximum length of a segment of a pattern
+    static constexpr std::size_t max_segment_length = 63;
+
+    static bool match_children(std::size_t node, const char * pattern, auto& f)
+    {
+        const char * end = pattern;
+        while (*end && *end != '/') ++end;
+        std::size_t length = end - pattern;
+        char segment[max_segment_length + 1];
+        std::copy(pattern, end, segment);
+        segment[length] = '\0';
+        osc_compiled_pattern compiled;
+        if (not osc_compile_pattern(segment, compiled)) return false;
+
+        for ( std::size_t child = table.nodes[node].first_child
+            ; child != trie_none
+            ; child = table.nodes[child].next_sibling
+            )
+        {
+            if (not osc_match_pattern(compiled, table.chars.data() + table.nodes[child].segment))
+                continue;
+            if (*end == '\0')
+                for (std::size_t e = table.nodes[child].entity; e != trie_none; e = table.next_same[e])
+                    f(e);
+            else if (not match_children(child, end + 1, f)) return false;
+        }
+        return true;
+    }
+
+    /// Whether every segment of `pattern` fits in the buffer used by `match_children`
+    static bool segments_fit(const char * pattern)
+    {
+        std::size_t length = 0;
+        for (; *pattern; ++pattern)
+        {
+            if (*pattern == '/') length = 0;
+            else if (++length > max_segment_length) return false;
+        }
+        return true;
+    }
+
+    /// Call `f` with the index of every entity whose address matches `pattern`, in tree order, returning false if the pattern doesn't compile
+    template<typename F>
+    static bool match(const char * pattern, F&& f)
+    {
+        if (*pattern != '/') return true;
+        if (std::strstr(pattern, "//") || not segments_fit(pattern))
+        {
+            osc_compiled_pattern compiled;
+            if (not osc_compile_pattern(pattern, compiled)) return false;
+            for (std::size_t e = 0; e < size; ++e)
+                if (osc_match_pattern(compiled, paths[e])) f(e);
+            return true;
+        }
+        return match_children(0, pattern + 1, f);
+    }
+
+    /// Call `f(entity, tag)` for every entity whose address matches `pattern`, where `tag` is an instance of the entity's node tag, returning false if the pattern doesn't compile
+    template<typename F>
+    static bool for_each_match(const char * pattern, Components& components, F&& f)
+    {
+        if constexpr (size > 0) return match(pattern, [&](std::size_t e)
+        {
+            boost::mp11::mp_with_index<size>(e, [&](auto I)
+            {
+                using Node = boost::mp11::mp_at_c<entities, I>;
+                f(Node::get(components), typename Node::tag{});
+            });
+        });
+        else return true;
+    }
+};
+
+///\}
+///\}
+} }
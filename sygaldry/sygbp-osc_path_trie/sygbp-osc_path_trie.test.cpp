@@ -0,0 +1,104 @@
+/*
+Copyright 2026 Travis J. West, https://traviswest.ca, Input Devices and Music
+Interaction Laboratory (IDMIL), Centre for Interdisciplinary Research in Music
+Media and Technology (CIRMMT), McGill University, Montréal, Canada, and Univ.
+Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
+
+SPDX-License-Identifier: MIT
+*/
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include "sygbp-test_component.hpp"
+#include "sygbp-osc_path_trie.hpp"
+
+using std::string;
+using std::string_view;
+using namespace sygaldry;
+using namespace sygaldry::sygbp;
+
+struct trie_test_components
+{
+    TestComponent tc;
+};
+
+using trie = osc_path_trie<trie_test_components>;
+
+// the component and its 14 endpoints
+static_assert(trie::size == 15);
+// the root, the component, and 14 endpoint segments
+static_assert(trie::table.node_count == 16);
+static_assert(string_view(trie::paths[0]) == string_view("/Test_Component_1"));
+
+std::vector<string> matches(const char * pattern)
+{
+    std::vector<string> ret{};
+    trie::match(pattern, [&](std::size_t e) { ret.emplace_back(trie::paths[e]); });
+    return ret;
+}
+
+TEST_CASE("sygaldry osc_path_trie match")
+{
+    using v = std::vector<string>;
+    CHECK(matches("/Test_Component_1") == v{"/Test_Component_1"});
+    CHECK(matches("/Test_Component_1/slider_in") == v{"/Test_Component_1/slider_in"});
+    CHECK(matches("/Test_Component_1/slider_*") == v{"/Test_Component_1/slider_in", "/Test_Component_1/slider_out"});
+    CHECK(matches("/*/{bang,button}_out") == v{"/Test_Component_1/button_out", "/Test_Component_1/bang_out"});
+    CHECK(matches("/*").size() == 1);
+    CHECK(matches("/*/*").size() == 14);
+    CHECK(matches("/*/*_in").size() == 7);
+    CHECK(matches("//text_in") == v{"/Test_Component_1/text_in"});
+    CHECK(matches("/Other_Component/*").empty());
+    CHECK(matches("/Test_Component_1/slider_in/extra").empty());
+    CHECK(matches("Test_Component_1").empty());
+    CHECK(matches("/").empty());
+
+    // segments too long for the buffer are matched by a linear scan
+    const char * long_segment = "/Test_Component_1/{slider_in,an_alternative_long_enough_to_not_fit_in_a_segment_buffer}";
+    REQUIRE(std::strlen(long_segment) - std::strlen("/Test_Component_1/") > trie::max_segment_length);
+    CHECK(matches(long_segment) == v{"/Test_Component_1/slider_in"});
+
+    // patterns that don't compile match nothing and are reported
+    auto ignore = [](std::size_t) {};
+    CHECK(trie::match("/Test_Component_1/slider_*", ignore));
+    CHECK(not trie::match("/Test_Component_1/[slider", ignore));
+    CHECK(not trie::match("//[slider", ignore));
+    CHECK(matches("/Test_Component_1/[slider").empty());
+    std::string too_long = "/Test_Component_1/{slider_in,x}";
+    for (std::size_t i = 0; i <= osc_compiled_pattern::max_ranges; ++i) too_long += "[!x]";
+    CHECK(not trie::match(too_long.c_str(), ignore));
+}
+
+TEST_CASE("sygaldry osc_path_trie for_each_match")
+{
+    trie_test_components components{};
+    int endpoints = 0;
+    trie::for_each_match("/Test_Component_1/*", components, [&]<typename T>(T& entity, auto tag)
+    {
+        if constexpr (node::is_endpoint<decltype(tag)>::value) ++endpoints;
+    });
+    CHECK(endpoints == 14);
+
+    trie::for_each_match("/Test_Component_1/slider_in", components, [&]<typename T>(T& entity, auto)
+    {
+        if constexpr (std::same_as<T, decltype(components.tc.inputs.slider_in)>) entity = 0.5f;
+    });
+    CHECK(components.tc.inputs.slider_in.value == 0.5f);
+}
+
+// duplicate addresses are all visited
+struct duplicate_trie_test_components
+{
+    TestComponent tc1;
+    TestComponent tc2;
+};
+static_assert(osc_path_trie<duplicate_trie_test_components>::table.node_count == 16);
+
+TEST_CASE("sygaldry osc_path_trie duplicates")
+{
+    std::size_t count = 0;
+    osc_path_trie<duplicate_trie_test_components>::match("/Test_Component_1/text_in", [&](std::size_t) { ++count; });
+    CHECK(count == 2);
+}
@@ -13,6 +13,7 @@ SPDX-License-Identifier: MIT
 #include "sygac-components.hpp"
 #include "sygah-metadata.hpp"
 #include "sygbp-osc_string_constants.hpp"
+#include "sygbp-endpoint_registry.hpp"
 #include "sygup-cstdio_logger.hpp"
 
 namespace sygaldry { namespace sygbp {
@@ -28,27 +29,38 @@ struct OutputLogger : name_<"Output Logger">
 
     [[no_unique_address]] Logger log;
 
+    using registry = endpoint_registry<Components>;
+
+    /// The last value logged of each persistent output
+    endpoint_value_cache<Components> cache{};
+
+    void print_value(const endpoint_descriptor<Components>& d, Components& components)
+    {
+        auto print_element = [&](std::size_t i)
+        {
+            visit_element(d.element, d.value(components), i, [&](auto& x) { log.print(x); });
+        };
+        log.print(" ");
+        if (not d.array) return print_element(0);
+        log.print("[");
+        for (std::size_t i = 0; i < d.size; ++i)
+        {
+            if (i) log.print(" ");
+            print_element(i);
+        }
+        log.print("]");
+    }
+
     void external_destinations(Components& components)
     {
-        for_each_output(components, [&]<typename T>(T& current_out)
+        for (std::size_t i = 0; i < registry::size; ++i)
         {
-            if constexpr (Bang<T> || OccasionalValue<T>)
-            {
-                if (not flag_state_of(current_out)) return;
-                log.println(osc_path_v<T, Components>);
-            }
-            else if constexpr (requires (T t) {current_out == t;})
-            {
-                static T last_out{};
-                if (value_of(current_out) == value_of(last_out)) return;
-                last_out = current_out;
-                log.print(osc_path_v<T, Components>);
-                if constexpr (has_value<T>)
-                    log.print(" ", value_of(current_out));
-                log.println();
-            }
-            else return;
-        });
+            const auto& d = registry::endpoints[i];
+            if (d.input || not cache.changed(i, components)) continue;
+            log.print(d.path);
+            if (not d.occasional) print_value(d, components);
+            log.println();
+        }
     }
 };
 
@@ -0,0 +1,323 @@
+#pragma once
+/*
+Copyright 2026 Travis J. West, https://traviswest.ca, Input Devices and Music
+Interaction Laboratory (IDMIL), Centre for Interdisciplinary Research in Music
+Media and Technology (CIRMMT), McGill University, Montréal, Canada, and Univ.
+Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
+
+SPDX-License-Identifier: MIT
+*/
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "sygac-runtime.hpp"
+
+namespace sygaldry { namespace sygbp {
+
+/// \addtogroup sygbp
+/// \{
+
+/// \defgroup sygbp-parallel_runtime sygbp-parallel_runtime: Parallel Runtime
+/// Literate source code: page-sygbp-parallel_runtime
+/// \{
+
+/// Compile-time graph of the conflicts between the main subroutines of the components managed by a `Runtime`
+template<typename ComponentContainer>
+struct parallel_main_graph
+: main_dependency_graph<decltype(component_to_runtime_tuple(std::declval<ComponentContainer&>()))>
+{
+    using base = main_dependency_graph<decltype(component_to_runtime_tuple(std::declval<ComponentContainer&>()))>;
+
+    /// The number of components
+    static constexpr std::size_t size = base::size;
+
+    /// Whether the main subroutine of component `i` must wait for that of component `j`
+    static constexpr bool depends(std::size_t i, std::size_t j)
+    {
+        if (base::position[j] >= base::position[i]) return false;
+        for (std::size_t k = 0; k < size; ++k)
+            if (base::footprints[i][k] && base::footprints[j][k]) return true;
+        return false;
+    }
+
+    /// The number of components each component must wait for
+    static constexpr std::array<std::size_t, size> predecessor_count = []()
+    {
+        std::array<std::size_t, size> ret{};
+        for (std::size_t i = 0; i < size; ++i)
+            for (std::size_t j = 0; j < size; ++j)
+                if (depends(i, j)) ++ret[i];
+        return ret;
+    }();
+
+    /// The number of components waiting for each component
+    static constexpr std::array<std::size_t, size> successor_count = []()
+    {
+        std::array<std::size_t, size> ret{};
+        for (std::size_t i = 0; i < size; ++i)
+            for (std::size_t j = 0; j < size; ++j)
+                if (depends(j, i)) ++ret[i];
+        return ret;
+    }();
+
+    /// The indices of the components waiting for each component; only the first `successor_count[i]` entries of row `i` are valid
+    static constexpr std::array<std::array<std::size_t, size>, size> successors = []()
+    {
+        std::array<std::array<std::size_t, size>, size> ret{};
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            std::size_t n = 0;
+            for (std::size_t j = 0; j < size; ++j)
+                if (depends(j, i)) ret[i][n++] = j;
+        }
+        return ret;
+    }();
+};
+
+/*! \brief A runtime that runs independent main subroutines on a thread pool
+
+\details Behaves like sygaldry::Runtime, but runs the main subroutines of
+components whose throughpoints and plugins don't overlap at the same time on a
+work-stealing thread pool. Components that depend on one another through their
+main subroutine arguments are run in the sequential runtime's order, so every component sees the
+same values as it would with the sequential runtime.
+
+\tparam ComponentContainer The type of the component container; this can
+usually be deduced from the constructor, e.g. `auto runtime = ParallelRuntime{container};`
+*/
+template<typename ComponentContainer>
+struct ParallelRuntime
+{
+    /// The dependency graph between components' main subroutines
+    using graph = parallel_main_graph<ComponentContainer>;
+
+    /// The number of components
+    static constexpr std::size_t size = graph::size;
+
+    /// The sequential runtime, used for everything except running main subroutines
+    const Runtime<ComponentContainer> runtime;
+
+    /// A reference to the component container managed by the runtime
+    ComponentContainer& container;
+
+    /// A worker's queue of components ready to run
+    struct task_queue
+    {
+        std::mutex mutex;
+        std::array<std::size_t, size> tasks{};
+        std::size_t head = 0; // the oldest task, stolen by other workers
+        std::size_t tail = 0; // one past the newest task, taken by the owner
+    };
+
+    /// The task queue of each worker
+    std::vector<task_queue> queues;
+
+    /// The number of tasks in all of the queues
+    std::atomic<std::size_t> queued{0};
+
+    void push(std::size_t worker, std::size_t task)
+    {
+        {
+            auto& q = queues[worker];
+            std::lock_guard lock{q.mutex};
+            q.tasks[q.tail++] = task;
+            queued.fetch_add(1);
+        }
+        notify(ready, false);
+    }
+
+    bool pop(std::size_t worker, std::size_t& task)
+    {
+        auto& q = queues[worker];
+        std::lock_guard lock{q.mutex};
+        if (q.head == q.tail) return false;
+        task = q.tasks[--q.tail];
+        queued.fetch_sub(1);
+        return true;
+    }
+
+    bool steal(std::size_t thief, std::size_t& task)
+    {
+        for (std::size_t offset = 1; offset < queues.size(); ++offset)
+        {
+            auto& q = queues[(thief + offset) % queues.size()];
+            std::lock_guard lock{q.mutex};
+            if (q.head == q.tail) continue;
+            task = q.tasks[q.head++];
+            queued.fetch_sub(1);
+            return true;
+        }
+        return false;
+    }
+
+    /// Serializes the runtime profiler, if any, between the workers
+    std::mutex profiler_mutex;
+
+    /// A table of functions running the main subroutine of each component, if it is due
+    static constexpr auto run_main = []<std::size_t ... I>(std::index_sequence<I...>)
+    {
+        return std::array<void(*)(ParallelRuntime&), size>{
+            +[](ParallelRuntime& self)
+            {
+                constexpr auto index = std::integral_constant<std::size_t, I>{};
+                const auto& runtime = self.runtime;
+                auto& r = tpl::get<I>(runtime.component_runtimes);
+                if (runtime.is_due(index))
+                    runtime.template profile<runtime_subroutine::main>(r, I, [&](){runtime.run_main(r, index);}, self.profiler_mutex);
+            }...
+        };
+    }(std::make_index_sequence<size>{});
+
+    /// The count of unfinished predecessors of each component in the current tick
+    std::array<std::atomic<std::size_t>, size> pending{};
+
+    /// The count of components that have not yet finished in the current tick
+    std::atomic<std::size_t> remaining{0};
+
+    std::mutex mutex;
+    std::condition_variable wake; // the start of a tick, or the destruction of the runtime
+    std::condition_variable ready; // a task was pushed, or the tick is finished
+    std::uint64_t generation = 0;
+    bool stopping = false;
+    std::vector<std::thread> workers;
+
+    void notify(std::condition_variable& cv, bool all)
+    {
+        {
+            std::lock_guard lock{mutex};
+        }
+        if (all) cv.notify_all();
+        else cv.notify_one();
+    }
+
+    void work(std::size_t self)
+    {
+        while (remaining.load() > 0)
+        {
+            std::size_t task;
+            if (pop(self, task) || steal(self, task))
+            {
+                run_main[task](*this);
+                for (std::size_t k = 0; k < graph::successor_count[task]; ++k)
+                {
+                    auto successor = graph::successors[task][k];
+                    if (pending[successor].fetch_sub(1) == 1) push(self, successor);
+                }
+                if (remaining.fetch_sub(1) == 1) notify(ready, true);
+            }
+            else
+            {
+                std::unique_lock lock{mutex};
+                ready.wait(lock, [&](){return remaining.load() == 0 || queued.load() > 0;});
+            }
+        }
+    }
+
+    void worker(std::size_t self)
+    {
+        std::uint64_t seen = 0;
+        while (true)
+        {
+            {
+                std::unique_lock lock{mutex};
+                wake.wait(lock, [&](){return stopping || generation != seen;});
+                if (stopping) return;
+                seen = generation;
+            }
+            work(self);
+        }
+    }
+
+    /*! \brief Construct the runtime and start its worker threads
+
+    \param[in,out] c The component container managed by the runtime
+    \param[in] threads The number of threads to use, including the calling thread; no more threads than components are used
+    */
+    ParallelRuntime(ComponentContainer& c, std::size_t threads = std::thread::hardware_concurrency())
+    : runtime{c}, container{c}, queues(std::max<std::size_t>(1, std::min(threads, size)))
+    {
+        for (std::size_t w = 1; w < queues.size(); ++w)
+            workers.emplace_back([this, w](){worker(w);});
+    }
+
+    ParallelRuntime(const ParallelRuntime&) = delete;
+    ParallelRuntime& operator=(const ParallelRuntime&) = delete;
+
+    /// Stop and join the worker threads
+    ~ParallelRuntime()
+    {
+        {
+            std::lock_guard lock{mutex};
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto& t : workers) t.join();
+    }
+
+    /// Initialize all components in the container.
+    void init() { runtime.init(); }
+
+    /// Clear input flags, then run the external sources subroutines, as the sequential runtime does.
+    void external_sources() { runtime.external_sources(); }
+
+    /// Run the main subroutines of all components that are due, in parallel where possible
+    void main()
+    {
+        for (std::size_t i = 0; i < size; ++i) pending[i].store(graph::predecessor_count[i]);
+        for (auto& q : queues)
+        {
+            std::lock_guard lock{q.mutex};
+            q.head = q.tail = 0;
+        }
+        queued.store(0);
+        remaining.store(size);
+        std::size_t next_worker = 0;
+        for (std::size_t i = 0; i < size; ++i)
+            if (graph::predecessor_count[i] == 0) push(next_worker++ % queues.size(), i);
+        {
+            std::lock_guard lock{mutex};
+            ++generation;
+        }
+        wake.notify_all();
+        work(0);
+    }
+
+    /// Run the external destinations subroutines, then clear output flags, as the sequential runtime does.
+    void external_destinations() { runtime.external_destinations(); }
+
+    /// Run external sources, main, and external destinations, advancing the schedule by one tick
+    void tick()
+    {
+        runtime.tick_started();
+        runtime.advance();
+        external_sources();
+        main();
+        external_destinations();
+        runtime.tick_finished();
+    }
+
+    /// Run a tick, advancing the schedule according to the time elapsed since the last call, given a timestamp in microseconds
+    void tick(unsigned long now)
+    {
+        runtime.tick_started();
+        runtime.advance(now);
+        external_sources();
+        main();
+        external_destinations();
+        runtime.tick_finished();
+    }
+
+    /// A wrapper for `init` and `tick` that loops indefinitely
+    int app_main() { for (init(); true; tick()) {} return 0; }
+};
+
+/// \}
+/// \}
+
+} }
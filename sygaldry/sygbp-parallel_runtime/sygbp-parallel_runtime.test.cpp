@@ -0,0 +1,239 @@
+/*
+Copyright 2026 Travis J. West, https://traviswest.ca, Input Devices and Music
+Interaction Laboratory (IDMIL), Centre for Interdisciplinary Research in Music
+Media and Technology (CIRMMT), McGill University, Montréal, Canada, and Univ.
+Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
+
+SPDX-License-Identifier: MIT
+*/
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <catch2/catch_test_macros.hpp>
+#include "sygah-metadata.hpp"
+#include "sygbp-parallel_runtime.hpp"
+
+using namespace sygaldry;
+using namespace sygaldry::sygbp;
+
+template<string_literal str>
+struct counter_t : name_<str>
+{
+    struct outputs_t {
+        struct count_t {
+            int value;
+        } count;
+    } outputs;
+
+    void main() { ++outputs.count.value; }
+};
+
+struct sum_t : name_<"sum">
+{
+    struct outputs_t {
+        struct sum_out_t {
+            int value;
+        } sum;
+    } outputs;
+
+    void main(const counter_t<"a">::outputs_t& a, const counter_t<"b">::outputs_t& b)
+    {
+        outputs.sum.value = a.count.value + b.count.value;
+    }
+};
+
+struct square_t : name_<"square">
+{
+    struct outputs_t {
+        struct square_out_t {
+            int value;
+        } square;
+    } outputs;
+
+    void main(sum_t& sum) { outputs.square.value = sum.outputs.sum.value * sum.outputs.sum.value; }
+};
+
+struct feedback_t : name_<"feedback">
+{
+    struct outputs_t {
+        struct last_t {
+            int value;
+        } last;
+    } outputs;
+
+    void main(const square_t::outputs_t& square) { outputs.last.value = square.square.value; }
+};
+
+struct parallel_components_t
+{
+    counter_t<"a"> a;
+    counter_t<"b"> b;
+    feedback_t feedback;
+    sum_t sum;
+    square_t square;
+    counter_t<"c"> c;
+};
+
+TEST_CASE("sygaldry parallel runtime dependency graph", "[bindings][parallel_runtime]")
+{
+    using graph = parallel_main_graph<parallel_components_t>;
+    static_assert(graph::size == 6);
+    static_assert(graph::depends(3, 0)); // sum waits for a
+    static_assert(graph::depends(3, 1)); // and b
+    static_assert(graph::depends(4, 3)); // square waits for sum
+    static_assert(graph::depends(2, 4)); // feedback waits for square, which is declared after it
+    static_assert(not graph::depends(4, 2));
+    static_assert(not graph::depends(2, 0)); // feedback doesn't wait for a
+    static_assert(not graph::depends(5, 0)); // c is independent
+    static_assert(not graph::depends(5, 4));
+    static_assert(graph::predecessor_count[0] == 0);
+    static_assert(graph::predecessor_count[3] == 2);
+}
+
+TEST_CASE("sygaldry parallel runtime", "[bindings][parallel_runtime]")
+{
+    static parallel_components_t sequential_components{};
+    static parallel_components_t parallel_components{};
+    auto sequential = Runtime{sequential_components};
+    auto parallel = ParallelRuntime{parallel_components, 4};
+    sequential.init();
+    parallel.init();
+    for (int i = 0; i < 1000; ++i)
+    {
+        sequential.tick();
+        parallel.tick();
+    }
+    CHECK(parallel_components.a.outputs.count.value == 1000);
+    CHECK(parallel_components.c.outputs.count.value == 1000);
+    CHECK(parallel_components.sum.outputs.sum.value == sequential_components.sum.outputs.sum.value);
+    CHECK(parallel_components.square.outputs.square.value == sequential_components.square.outputs.square.value);
+    CHECK(parallel_components.feedback.outputs.last.value == sequential_components.feedback.outputs.last.value);
+    CHECK(parallel_components.feedback.outputs.last.value == 4 * 1000 * 1000);
+}
+std::atomic<int> rendezvous_arrivals{0};
+
+template<string_literal str>
+struct rendezvous_t : name_<str>
+{
+    struct outputs_t {
+        struct met_t {
+            bool value;
+        } met;
+    } outputs;
+
+    void main()
+    {
+        rendezvous_arrivals.fetch_add(1);
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (rendezvous_arrivals.load() < 2 && std::chrono::steady_clock::now() < deadline)
+            std::this_thread::yield();
+        outputs.met.value = rendezvous_arrivals.load() >= 2;
+    }
+};
+
+struct rendezvous_components_t
+{
+    rendezvous_t<"x"> x;
+    rendezvous_t<"y"> y;
+};
+
+std::atomic<int> chain_running{0};
+std::atomic<bool> chain_overlapped{false};
+
+void chain_step()
+{
+    if (chain_running.fetch_add(1) != 0) chain_overlapped = true;
+    std::this_thread::sleep_for(std::chrono::microseconds(50));
+    chain_running.fetch_sub(1);
+}
+
+struct chain_head_t : name_<"head">
+{
+    struct outputs_t {
+        struct count_t {
+            int value;
+        } count;
+    } outputs;
+
+    void main() { chain_step(); ++outputs.count.value; }
+};
+
+struct chain_tail_t : name_<"tail">
+{
+    struct outputs_t {
+        struct count_t {
+            int value;
+        } count;
+    } outputs;
+
+    void main(const chain_head_t::outputs_t& head) { chain_step(); outputs.count.value = head.count.value; }
+};
+
+struct chain_components_t
+{
+    chain_tail_t tail; // declared first, but must still run after head
+    chain_head_t head;
+    counter_t<"a"> a;
+    counter_t<"b"> b;
+};
+
+TEST_CASE("sygaldry parallel runtime concurrency", "[bindings][parallel_runtime]")
+{
+    SECTION("independent components overlap")
+    {
+        static_assert(not parallel_main_graph<rendezvous_components_t>::depends(1, 0));
+        static rendezvous_components_t components{};
+        auto parallel = ParallelRuntime{components, 2};
+        parallel.init();
+        rendezvous_arrivals = 0;
+        parallel.tick();
+        CHECK(components.x.outputs.met.value);
+        CHECK(components.y.outputs.met.value);
+    }
+
+    SECTION("dependent components never overlap")
+    {
+        static_assert(parallel_main_graph<chain_components_t>::depends(0, 1));
+        static chain_components_t components{};
+        auto parallel = ParallelRuntime{components, 4};
+        parallel.init();
+        for (int i = 0; i < 200; ++i) parallel.tick();
+        CHECK(not chain_overlapped);
+        CHECK(components.tail.outputs.count.value == 200);
+    }
+}
+struct parallel_profiler_t : name_<"profiler">
+{
+    std::array<int, 5> mains{};
+    int recording = 0;
+    bool overlapped = false;
+
+    unsigned long timestamp() { return 0; }
+    void record(std::size_t index, runtime_subroutine subroutine, unsigned long)
+    {
+        if (recording++ != 0) overlapped = true;
+        if (subroutine == runtime_subroutine::main) ++mains[index];
+        --recording;
+    }
+    void main() { if (recording != 0) overlapped = true; }
+};
+
+struct profiled_parallel_components_t
+{
+    counter_t<"a"> a;
+    counter_t<"b"> b;
+    sum_t sum;
+    parallel_profiler_t profiler;
+    counter_t<"c"> c;
+};
+
+TEST_CASE("sygaldry parallel runtime profiling", "[bindings][parallel_runtime]")
+{
+    static profiled_parallel_components_t components{};
+    auto parallel = ParallelRuntime{components, 4};
+    parallel.init();
+    for (int i = 0; i < 1000; ++i) parallel.tick();
+    CHECK(components.profiler.mains == std::array<int, 5>{1000, 1000, 1000, 1000, 1000});
+    CHECK(not components.profiler.overlapped);
+}
@@ -0,0 +1,267 @@
+#pragma once
+/*
+Copyright 2026 Travis J. West, https://traviswest.ca, Input Devices and Music
+Interaction Laboratory (IDMIL), Centre for Interdisciplinary Research in Music
+Media and Technology (CIRMMT), McGill University, Montréal, Canada, and Univ.
+Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
+
+SPDX-License-Identifier: MIT
+*/
+
+#include <array>
+#include <concepts>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include "sygac-runtime.hpp"
+
+namespace sygaldry { namespace sygbp {
+
+/// \addtogroup sygbp
+/// \{
+
+/// \defgroup sygbp-pipelined_runtime sygbp-pipelined_runtime: Pipelined Runtime
+/// Literate source code: page-sygbp-pipelined_runtime
+/// \{
+
+/// Check if T is a component that can report whether its next subroutine touches state used by its external destinations
+template<typename T>
+concept DestinationConflictReporter = Component<T> && requires (const T& t)
+{
+    {t.conflicts_with_destinations()} -> std::convertible_to<bool>;
+};
+
+/*! \brief A runtime that runs each tick's external destinations while the next tick runs
+
+\details Behaves like sygaldry::Runtime, but runs the external destinations
+subroutines of each tick on a second thread, with arguments extracted from a
+snapshot of the endpoints taken at the end of the tick, while the external
+sources and main subroutines of the next tick run on the calling thread.
+The endpoints of every component must be copy assignable.
+
+\tparam ComponentContainer The type of the component container; this can
+usually be deduced from the constructor, e.g. `auto runtime = PipelinedRuntime{container};`
+*/
+template<typename ComponentContainer>
+struct PipelinedRuntime
+{
+    /// The sequential runtime, used to advance the schedule and run external sources and main subroutines
+    const Runtime<ComponentContainer> runtime;
+
+    /// A reference to the component container managed by the runtime
+    ComponentContainer& container;
+
+    /// A copy of the component container, with a runtime used to extract subroutine arguments from it
+    struct snapshot_t
+    {
+        ComponentContainer container{};
+        const Runtime<ComponentContainer> runtime{container};
+    };
+
+    /// The snapshots used to run external destinations, alternately
+    std::array<snapshot_t, 2> snapshots{};
+
+    /// The index of the snapshot to be taken at the end of the next tick
+    std::size_t next = 0;
+
+    /// Copy the endpoints of every component, and the schedule of the current tick, into the snapshot `s`
+    void capture(snapshot_t& s)
+    {
+        runtime.for_each_runtime([&](auto& r, auto i)
+        {
+            using component_t = std::remove_cvref_t<decltype(r.component)>;
+            auto& copy = tpl::get<decltype(i)::value>(s.runtime.component_runtimes).component;
+            if constexpr (has_inputs<component_t>) inputs_of(copy) = inputs_of(r.component);
+            if constexpr (has_outputs<component_t>) outputs_of(copy) = outputs_of(r.component);
+        });
+        s.runtime.due = runtime.due;
+    }
+
+    /// Run the external destinations subroutines due in the snapshot `s`, with arguments extracted from the snapshot
+    void run_destinations(const snapshot_t& s)
+    {
+        runtime.for_each_runtime([&](auto& r, auto i)
+        {
+            using component_t = std::remove_cvref_t<decltype(r.component)>;
+            if constexpr (has_external_destinations_subroutine<component_t>)
+            {
+                if (not s.runtime.is_due(i)) return;
+                auto& args = tpl::get<decltype(i)::value>(s.runtime.component_runtimes).ext_dst_args.pack;
+                profile<runtime_subroutine::external_destinations>(r, i, [&]()
+                {
+                    tpl::apply([&](auto& ... a) {r.component.external_destinations(a...);}, args);
+                });
+            }
+        });
+    }
+
+    std::mutex mutex;
+    std::condition_variable posted;
+    std::condition_variable finished;
+    std::size_t current = 0;
+    bool finishes_tick = false;
+    bool busy = false;
+    bool stopping = false;
+
+    void destinations()
+    {
+        std::unique_lock lock{mutex};
+        while (true)
+        {
+            posted.wait(lock, [&](){return stopping || busy;});
+            if (not busy) return;
+            bool finish = finishes_tick;
+            lock.unlock();
+            run_destinations(snapshots[current]);
+            if (finish) runtime.tick_finished();
+            lock.lock();
+            busy = false;
+            finished.notify_all();
+        }
+    }
+
+    /// Hand the snapshot at `index` to the destination thread, which must have finished with the previous one
+    void post(std::size_t index, bool finish_tick)
+    {
+        {
+            std::lock_guard lock{mutex};
+            current = index;
+            finishes_tick = finish_tick;
+            busy = true;
+        }
+        posted.notify_one();
+    }
+    /// Serializes the runtime profiler, if any, between the calling thread and the destination thread
+    std::mutex profiler_mutex;
+
+    template<runtime_subroutine S>
+    void profile(auto& r, std::size_t index, auto&& f)
+    {
+        runtime.template profile<S>(r, index, f, profiler_mutex);
+    }
+
+    std::thread destination_thread;
+
+    /*! \brief Construct the runtime and start its destination thread
+
+    \param[in,out] c The component container managed by the runtime
+    */
+    PipelinedRuntime(ComponentContainer& c)
+    : runtime{c}, container{c}, destination_thread{[this](){destinations();}} {}
+
+    PipelinedRuntime(const PipelinedRuntime&) = delete;
+    PipelinedRuntime& operator=(const PipelinedRuntime&) = delete;
+
+    /// Finish any pending external destinations, then stop and join the destination thread
+    ~PipelinedRuntime()
+    {
+        {
+            std::lock_guard lock{mutex};
+            stopping = true;
+        }
+        posted.notify_one();
+        destination_thread.join();
+    }
+
+    /// Wait for the destination thread to finish the external destinations of the previous tick
+    void flush()
+    {
+        std::unique_lock lock{mutex};
+        finished.wait(lock, [&](){return not busy;});
+    }
+
+    /// Initialize all components in the container.
+    void init() { flush(); runtime.init(); }
+
+    /// Wait for the destination thread before running a subroutine of `component`, if it has external destinations that may touch the same state
+    template<typename T>
+    void wait_for_destinations(T& component)
+    {
+        if constexpr (DestinationConflictReporter<T>)
+        {
+            if (component.conflicts_with_destinations()) flush();
+        }
+        else if constexpr (has_external_destinations_subroutine<T>) flush();
+    }
+
+    /// Clear input flags, then run the external sources subroutines, as the sequential runtime does, waiting for the destination thread before touching components with external destinations
+    void external_sources()
+    {
+        runtime.for_each_runtime([&](auto& r, auto i)
+        {
+            if (not runtime.ran[i]) return;
+            wait_for_destinations(r.component);
+            clear_input_flags(r.component, runtime.packed_flags_of(i));
+        });
+        runtime.for_each_runtime([&](auto& r, auto i)
+        {
+            if (not runtime.is_due(i)) return;
+            wait_for_destinations(r.component);
+            profile<runtime_subroutine::external_sources>(r, i, [&](){r.external_sources();});
+        });
+    }
+
+    /// Run the main subroutines of all components that are due in dependency order, waiting for the destination thread before running those with external destinations
+    void main()
+    {
+        runtime.for_each_runtime_in_main_order([&](auto& r, auto i)
+        {
+            if (not runtime.is_due(i)) return;
+            wait_for_destinations(r.component);
+            profile<runtime_subroutine::main>(r, i, [&](){runtime.run_main(r, i);});
+        });
+    }
+
+    /// Wait for the previous tick's external destinations, take a snapshot of the endpoints, clear output flags, and hand the snapshot to the destination thread
+    void external_destinations() { external_destinations(false); }
+
+    /// Run external sources and main, and start external destinations, advancing the schedule by one tick
+    void tick()
+    {
+        tick_started();
+        runtime.advance();
+        external_sources();
+        main();
+        external_destinations(true);
+    }
+
+    /// Run a tick, advancing the schedule according to the time elapsed since the last call, given a timestamp in microseconds
+    void tick(unsigned long now)
+    {
+        tick_started();
+        runtime.advance(now);
+        external_sources();
+        main();
+        external_destinations(true);
+    }
+
+    /// A wrapper for `init` and `tick` that loops indefinitely
+    int app_main() { for (init(); true; tick()) {} return 0; }
+
+private:
+    void external_destinations(bool finish_tick)
+    {
+        flush();
+        capture(snapshots[next]);
+        runtime.for_each_runtime([&](auto& r, auto i){clear_output_flags(r.component, runtime.packed_flags_of(i));});
+        runtime.ran = runtime.due;
+        post(next, finish_tick);
+        next = 1 - next;
+    }
+
+    /// Notify the tick monitor, if any, that a tick is beginning, once the previous tick has finished
+    void tick_started()
+    {
+        if constexpr (not std::same_as<decltype(runtime.monitor), no_runtime_hook>)
+        {
+            flush();
+            runtime.tick_started();
+        }
+    }
+};
+
+/// \}
+/// \}
+
+} }
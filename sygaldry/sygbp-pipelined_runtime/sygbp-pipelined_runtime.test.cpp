@@ -0,0 +1,263 @@
+/*
+Copyright 2026 Travis J. West, https://traviswest.ca, Input Devices and Music
+Interaction Laboratory (IDMIL), Centre for Interdisciplinary Research in Music
+Media and Technology (CIRMMT), McGill University, Montréal, Canada, and Univ.
+Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
+
+SPDX-License-Identifier: MIT
+*/
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <catch2/catch_test_macros.hpp>
+#include "sygah-endpoints.hpp"
+#include "sygah-metadata.hpp"
+#include "sygbp-pipelined_runtime.hpp"
+
+using namespace sygaldry;
+using namespace sygaldry::sygbp;
+
+struct pipelined_source_t : name_<"source">, period_<1000>
+{
+    struct outputs_t {
+        bng<"even"> even;
+        struct count_t {
+            int value;
+        } count;
+    } outputs;
+
+    void main()
+    {
+        ++outputs.count.value;
+        if (outputs.count.value % 2 == 0) outputs.even();
+    }
+};
+
+struct pipelined_recorder_t : name_<"recorder">, period_<2000>
+{
+    struct outputs_t {
+        struct runs_t {
+            int value;
+        } runs;
+    } outputs;
+
+    std::vector<std::pair<int, bool>> log;
+    bool sending = false;
+    bool overlapped = false;
+
+    void main() { if (sending) overlapped = true; ++outputs.runs.value; }
+
+    void external_destinations(pipelined_source_t::outputs_t& source)
+    {
+        sending = true;
+        log.emplace_back(source.count.value, flag_state_of(source.even));
+        sending = false;
+    }
+};
+
+struct pipelined_components_t
+{
+    pipelined_source_t source;
+    pipelined_recorder_t recorder;
+};
+
+TEST_CASE("sygaldry pipelined runtime", "[bindings][pipelined_runtime]")
+{
+    static pipelined_components_t sequential_components{};
+    static pipelined_components_t pipelined_components{};
+    auto sequential = Runtime{sequential_components};
+    auto pipelined = PipelinedRuntime{pipelined_components};
+    sequential.init();
+    pipelined.init();
+    for (int i = 0; i < 1000; ++i)
+    {
+        sequential.tick();
+        pipelined.tick();
+        CHECK(not flag_state_of(pipelined_components.source.outputs.even));
+    }
+    pipelined.flush();
+    CHECK(pipelined_components.recorder.log.size() == 500);
+    CHECK(pipelined_components.recorder.log == sequential_components.recorder.log);
+    CHECK(pipelined_components.recorder.outputs.runs.value == sequential_components.recorder.outputs.runs.value);
+    CHECK(not pipelined_components.recorder.overlapped);
+}
+
+int pipelined_destinations_run = 0;
+
+struct pipelined_binding_t : name_<"binding">
+{
+    struct outputs_t {
+        struct sent_t {
+            int value;
+        } sent;
+    } outputs;
+
+    int state = 0; // shared by all of the binding's subroutines
+    int running = 0;
+    bool overlapped = false;
+
+    void enter() { if (running++ != 0) overlapped = true; ++state; }
+    void leave() { --running; }
+
+    void external_sources() { enter(); leave(); }
+    void main() { enter(); leave(); }
+    void external_destinations(pipelined_source_t::outputs_t&)
+    {
+        enter();
+        ++outputs.sent.value;
+        ++pipelined_destinations_run;
+        leave();
+    }
+};
+
+struct pipelined_monitor_t : name_<"monitor">
+{
+    int started = 0;
+    int finished = 0;
+    int main_during_tick = 0;
+    bool early = false;
+
+    void tick_started() { ++started; }
+    void tick_finished() { if (++finished != started || pipelined_destinations_run != finished) early = true; }
+    void main() { main_during_tick = started - finished; }
+};
+
+struct pipelined_binding_components_t
+{
+    pipelined_source_t source;
+    pipelined_binding_t binding;
+    pipelined_monitor_t monitor;
+};
+
+TEST_CASE("sygaldry pipelined runtime binding", "[bindings][pipelined_runtime]")
+{
+    static pipelined_binding_components_t components{};
+    pipelined_destinations_run = 0;
+    auto pipelined = PipelinedRuntime{components};
+    pipelined.init();
+    for (int i = 0; i < 1000; ++i) pipelined.tick();
+    pipelined.flush();
+    CHECK(not components.binding.overlapped);
+    CHECK(components.binding.state == 3000);
+    CHECK(components.binding.outputs.sent.value == 1000);
+    CHECK(components.monitor.finished == 1000);
+    CHECK(not components.monitor.early);
+    CHECK(components.monitor.main_during_tick == 1);
+}
+
+struct pipelined_profiler_t : name_<"profiler">
+{
+    std::array<std::array<int, 4>, 3> calls{};
+    int recording = 0;
+    bool overlapped = false;
+
+    unsigned long timestamp() { return 0; }
+    void record(std::size_t index, runtime_subroutine subroutine, unsigned long)
+    {
+        if (recording++ != 0) overlapped = true;
+        ++calls[index][static_cast<std::size_t>(subroutine)];
+        --recording;
+    }
+    void main() { if (recording != 0) overlapped = true; }
+};
+
+struct pipelined_profiled_components_t
+{
+    pipelined_source_t source;
+    pipelined_binding_t binding;
+    pipelined_profiler_t profiler;
+};
+
+TEST_CASE("sygaldry pipelined runtime profiling", "[bindings][pipelined_runtime]")
+{
+    static pipelined_profiled_components_t components{};
+    auto pipelined = PipelinedRuntime{components};
+    pipelined.init();
+    for (int i = 0; i < 1000; ++i) pipelined.tick();
+    pipelined.flush();
+    constexpr auto ext_src = static_cast<std::size_t>(runtime_subroutine::external_sources);
+    constexpr auto main = static_cast<std::size_t>(runtime_subroutine::main);
+    constexpr auto ext_dst = static_cast<std::size_t>(runtime_subroutine::external_destinations);
+    CHECK(components.profiler.calls[0][main] == 1000);
+    CHECK(components.profiler.calls[1][ext_src] == 1000);
+    CHECK(components.profiler.calls[1][main] == 1000);
+    CHECK(components.profiler.calls[1][ext_dst] == 1000);
+    CHECK(components.profiler.calls[2][main] == 1000);
+    CHECK(not components.profiler.overlapped);
+}
+
+std::atomic<bool> pipelined_destination_blocked{false};
+std::atomic<bool> pipelined_destination_sending{false};
+
+struct pipelined_blocking_binding_t : name_<"blocking binding">
+{
+    struct outputs_t {
+        struct sent_t {
+            int value;
+        } sent;
+    } outputs;
+
+    bool conflict = false;
+    bool overlapped = false;
+    int mains = 0;
+
+    bool conflicts_with_destinations() const { return conflict; }
+
+    void external_sources() { if (conflict && pipelined_destination_sending) overlapped = true; }
+    void main() { if (conflict && pipelined_destination_sending) overlapped = true; ++mains; }
+    void external_destinations(pipelined_source_t::outputs_t&)
+    {
+        pipelined_destination_sending = true;
+        while (pipelined_destination_blocked) std::this_thread::yield();
+        ++outputs.sent.value;
+        pipelined_destination_sending = false;
+    }
+};
+
+struct pipelined_blocking_components_t
+{
+    pipelined_source_t source;
+    pipelined_blocking_binding_t binding;
+};
+
+TEST_CASE("sygaldry pipelined runtime overlaps bindings without conflicts", "[bindings][pipelined_runtime]")
+{
+    static pipelined_blocking_components_t components{};
+    auto& binding = components.binding;
+    auto pipelined = PipelinedRuntime{components};
+    pipelined.init();
+    pipelined.tick();
+    pipelined.flush();
+
+    pipelined_destination_blocked = true;
+    pipelined.tick();
+    while (not pipelined_destination_sending) std::this_thread::yield();
+    pipelined.runtime.advance();
+    pipelined.external_sources();
+    pipelined.main();
+    CHECK(binding.mains == 3); // the next tick's main ran while the destination was blocked
+    CHECK(pipelined_destination_sending);
+    pipelined_destination_blocked = false;
+    pipelined.external_destinations();
+    pipelined.flush();
+    CHECK(binding.outputs.sent.value == 3);
+
+    binding.conflict = true;
+    pipelined_destination_blocked = true;
+    pipelined.tick();
+    while (not pipelined_destination_sending) std::this_thread::yield();
+    std::thread release{[&]()
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        pipelined_destination_blocked = false;
+    }};
+    pipelined.tick(); // waits for the destination before running the binding
+    release.join();
+    pipelined.flush();
+    CHECK(binding.mains == 5);
+    CHECK(binding.outputs.sent.value == 5);
+    CHECK(not binding.overlapped);
+}
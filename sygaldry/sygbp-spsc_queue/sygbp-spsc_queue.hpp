@@ -0,0 +1,89 @@
+#pragma once
+/*
+Copyright 2026 Travis J. West, https://traviswest.ca, Input Devices and Music
+Interaction Laboratory (IDMIL), Centre for Interdisciplinary Research in Music
+Media and Technology (CIRMMT), McGill University, Montréal, Canada, and Univ.
+Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
+
+SPDX-License-Identifier: MIT
+*/
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace sygaldry { namespace sygbp {
+///\addtogroup sygbp
+///\{
+///\defgroup sygbp-spsc_queue sygbp-spsc_queue: Single Producer Single Consumer Queue
+///\{
+
+/*! \brief A fixed capacity wait-free queue with a single producer thread and a single consumer thread
+
+\details `try_push` must only be called by the producer, and `try_pop` only by
+the consumer. `T` should be trivially copyable, so that elements can be
+copied in and out of the buffer cheaply.
+
+\tparam T The type of the elements
+\tparam N The capacity of the queue, which must be a power of two
+*/
+template<typename T, std::size_t N>
+struct spsc_queue
+{
+    static_assert(N > 0 && (N & (N - 1)) == 0, "spsc_queue: the capacity must be a power of two");
+
+    /// The maximum number of elements in the queue
+    static constexpr std::size_t capacity = N;
+
+    /// Copy `value` to the back of the queue, returning false if the queue is full
+    bool try_push(const T& value) noexcept
+    {
+        auto tail = producer.index.load(std::memory_order_relaxed);
+        if (tail - producer.cached >= N)
+        {
+            producer.cached = consumer.index.load(std::memory_order_acquire);
+            if (tail - producer.cached >= N) return false;
+        }
+        buffer[tail & (N - 1)] = value;
+        producer.index.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Move the front of the queue into `value`, returning false if the queue is empty
+    bool try_pop(T& value) noexcept
+    {
+        auto head = consumer.index.load(std::memory_order_relaxed);
+        if (head == consumer.cached)
+        {
+            consumer.cached = producer.index.load(std::memory_order_acquire);
+            if (head == consumer.cached) return false;
+        }
+        value = buffer[head & (N - 1)];
+        consumer.index.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// The number of elements in the queue; only exact when neither thread is using the queue
+    std::size_t size() const noexcept
+    {
+        return producer.index.load(std::memory_order_acquire) - consumer.index.load(std::memory_order_acquire);
+    }
+
+    /// Whether the queue is empty; only exact when neither thread is using the queue
+    bool empty() const noexcept { return size() == 0; }
+
+private:
+    struct alignas(64) side
+    {
+        std::atomic<std::size_t> index{0}; ///< The count of elements pushed or popped by this side
+        std::size_t cached = 0; ///< The last value of the other side's index seen by this side
+    };
+
+    side producer{};
+    side consumer{};
+    std::array<T, N> buffer{};
+};
+
+///\}
+///\}
+} }
@@ -0,0 +1,56 @@
+/*
+Copyright 2026 Travis J. West, https://traviswest.ca, Input Devices and Music
+Interaction Laboratory (IDMIL), Centre for Interdisciplinary Research in Music
+Media and Technology (CIRMMT), McGill University, Montréal, Canada, and Univ.
+Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
+
+SPDX-License-Identifier: MIT
+*/
+
+#include <thread>
+#include <catch2/catch_test_macros.hpp>
+#include "sygbp-spsc_queue.hpp"
+
+using namespace sygaldry;
+using namespace sygaldry::sygbp;
+
+TEST_CASE("sygaldry spsc_queue single thread")
+{
+    spsc_queue<int, 4> queue{};
+    int x = 0;
+    CHECK(queue.empty());
+    CHECK(not queue.try_pop(x));
+    for (int i = 0; i < 4; ++i) CHECK(queue.try_push(i));
+    CHECK(not queue.try_push(4));
+    CHECK(queue.size() == 4);
+    CHECK(queue.try_pop(x));
+    CHECK(x == 0);
+    CHECK(queue.try_push(4));
+    for (int i = 1; i < 5; ++i)
+    {
+        CHECK(queue.try_pop(x));
+        CHECK(x == i);
+    }
+    CHECK(not queue.try_pop(x));
+}
+
+TEST_CASE("sygaldry spsc_queue two threads")
+{
+    static spsc_queue<unsigned, 64> queue{};
+    constexpr unsigned count = 100000;
+    std::thread producer{[]()
+    {
+        for (unsigned i = 0; i < count; ++i)
+            while (not queue.try_push(i)) std::this_thread::yield();
+    }};
+    bool ordered = true;
+    for (unsigned i = 0; i < count; ++i)
+    {
+        unsigned x;
+        while (not queue.try_pop(x)) std::this_thread::yield();
+        ordered = ordered && x == i;
+    }
+    producer.join();
+    CHECK(ordered);
+    CHECK(queue.empty());
+}
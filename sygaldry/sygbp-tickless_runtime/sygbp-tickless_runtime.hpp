@@ -0,0 +1,139 @@
+#pragma once
+/*
+Copyright 2026 Travis J. West, https://traviswest.ca, Input Devices and Music
+Interaction Laboratory (IDMIL), Centre for Interdisciplinary Research in Music
+Media and Technology (CIRMMT), McGill University, Montréal, Canada, and Univ.
+Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
+
+SPDX-License-Identifier: MIT
+*/
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <concepts>
+#include <limits>
+#include <poll.h>
+#include <time.h>
+#include "sygac-components.hpp"
+#include "sygac-runtime.hpp"
+#include "sygsp-micros.hpp"
+
+namespace sygaldry { namespace sygbp {
+
+/// \addtogroup sygbp
+/// \{
+
+/// \defgroup sygbp-tickless_runtime sygbp-tickless_runtime: Tickless Runtime
+/// Literate source code: page-sygbp-tickless_runtime
+/// \{
+
+/// Check if T is a component that can report the time in microseconds until it next needs to run, given the current timestamp
+template<typename T>
+concept DeadlineReporter = Component<T> && requires (T& t, unsigned long now)
+{
+    {t.time_to_deadline(now)} -> std::convertible_to<unsigned long>;
+};
+
+/// Check if T is a component with a file descriptor that becomes readable when its external sources have input, or negative if there is none
+template<typename T>
+concept WaitableSource = Component<T> && requires (T& t)
+{
+    {t.wait_descriptor()} -> std::convertible_to<int>;
+};
+
+/*! \brief A runtime that sleeps between ticks until a deadline arrives or a binding has input
+
+\tparam ComponentContainer The type of the component container
+\tparam max_wait The longest time to sleep between ticks, in microseconds
+\tparam clock A function returning a timestamp in microseconds
+*/
+template<typename ComponentContainer, unsigned long max_wait = 10000, unsigned long (*clock)() = sygsp::micros>
+struct TicklessRuntime
+{
+    /// The sequential runtime, used to run each tick
+    const Runtime<ComponentContainer> runtime;
+
+    /// A reference to the component container managed by the runtime
+    ComponentContainer& container;
+
+    /// Construct the runtime, e.g. `constexpr auto runtime = TicklessRuntime{container};`
+    constexpr TicklessRuntime(ComponentContainer& c) : runtime{c}, container{c} {}
+
+    /// Get the time in microseconds to wait from the timestamp `now` before the loop next needs to tick
+    unsigned long timeout(unsigned long now) const
+    {
+        unsigned long ret = std::min(max_wait, runtime.time_to_next_tick(now));
+        for_each_component(container, [&]<typename T>(T& component)
+        {
+            if constexpr (DeadlineReporter<T>)
+                ret = std::min<unsigned long>(ret, component.time_to_deadline(now));
+        });
+        return ret;
+    }
+
+    /// Sleep for the given time in microseconds, or until a waitable source is readable, returning the number of readable sources
+    int wait(unsigned long timeout) const
+    {
+        std::array<pollfd, Runtime<ComponentContainer>::schedule::size> fds{};
+        nfds_t n = 0;
+        for_each_component(container, [&]<typename T>(T& component)
+        {
+            if constexpr (WaitableSource<T>)
+            {
+                int fd = component.wait_descriptor();
+                if (fd >= 0 && n < fds.size()) fds[n++] = pollfd{fd, POLLIN | POLLPRI, 0};
+            }
+        });
+        unsigned long start = clock();
+        for (unsigned long remaining = timeout; true;)
+        {
+            int ret = poll_for(fds.data(), n, remaining);
+            if (ret == 0 || (ret < 0 && errno == EINTR)) return 0;
+            if (ret < 0)
+            {
+                poll_for(nullptr, 0, remaining);
+                return 0;
+            }
+            int ready = 0;
+            nfds_t quiet = 0;
+            for (nfds_t i = 0; i < n; ++i)
+            {
+                if (fds[i].revents & (POLLIN | POLLPRI)) ++ready;
+                else if (fds[i].revents == 0) fds[quiet++] = fds[i];
+            }
+            if (ready > 0) return ready;
+            n = quiet; // only hung up, failed, or invalid descriptors were reported; wait on the others for the rest of the timeout
+            unsigned long elapsed = clock() - start;
+            if (elapsed >= timeout) return 0;
+            remaining = timeout - elapsed;
+        }
+    }
+
+    static int poll_for(pollfd * fds, nfds_t n, unsigned long timeout)
+    {
+    #ifdef __linux__
+        timespec ts{static_cast<time_t>(timeout / 1000000), static_cast<long>(timeout % 1000000) * 1000};
+        return ppoll(fds, n, &ts, nullptr);
+    #else
+        return poll(fds, n, static_cast<int>(std::min<unsigned long>((timeout + 999) / 1000, std::numeric_limits<int>::max())));
+    #endif
+    }
+
+    /// Initialize all components in the container.
+    void init() const { runtime.init(); }
+
+    /// Run a tick with the current timestamp
+    void tick() const { runtime.tick(clock()); }
+
+    /// Sleep until the loop next needs to tick
+    int wait() const { return wait(timeout(clock())); }
+
+    /// A wrapper for `init`, `tick`, and `wait` that loops indefinitely
+    int app_main() const { for (init(); true; wait()) tick(); return 0; }
+};
+
+/// \}
+/// \}
+
+} }
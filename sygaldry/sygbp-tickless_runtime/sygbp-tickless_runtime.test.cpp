@@ -0,0 +1,131 @@
+/*
+Copyright 2026 Travis J. West, https://traviswest.ca, Input Devices and Music
+Interaction Laboratory (IDMIL), Centre for Interdisciplinary Research in Music
+Media and Technology (CIRMMT), McGill University, Montréal, Canada, and Univ.
+Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
+
+SPDX-License-Identifier: MIT
+*/
+
+#include <chrono>
+#include <unistd.h>
+#include <catch2/catch_test_macros.hpp>
+#include "sygah-metadata.hpp"
+#include "sygbp-tickless_runtime.hpp"
+
+using namespace sygaldry;
+using namespace sygaldry::sygbp;
+
+unsigned long fake_time = 0;
+unsigned long fake_clock() { return fake_time; }
+unsigned long stepped_time = 0;
+unsigned long stepping_clock() { return stepped_time += 1000000; }
+
+struct reader_t : name_<"reader">
+{
+    int fds[2] = {-1, -1};
+    struct outputs_t {
+        struct received_t {
+            int value;
+        } received;
+    } outputs;
+
+    int wait_descriptor() { return fds[0]; }
+    void external_sources()
+    {
+        char c;
+        if (fds[0] >= 0 && read(fds[0], &c, 1) == 1) ++outputs.received.value;
+    }
+};
+
+struct periodic_t : name_<"periodic">, period_<5000>
+{
+    void main() {}
+};
+
+struct deadline_t : name_<"deadline">
+{
+    unsigned long deadline = 0;
+    unsigned long time_to_deadline(unsigned long now) { return deadline - now; }
+    void main() {}
+};
+
+struct tickless_components_t
+{
+    reader_t reader;
+    periodic_t periodic;
+    deadline_t deadline;
+};
+
+struct unscheduled_components_t
+{
+    deadline_t deadline;
+};
+
+TEST_CASE("sygaldry tickless runtime", "[bindings][tickless_runtime]")
+{
+    static_assert(WaitableSource<reader_t>);
+    static_assert(DeadlineReporter<deadline_t>);
+    static tickless_components_t c{};
+    constexpr auto runtime = TicklessRuntime<tickless_components_t, 100000, fake_clock>{c};
+    runtime.init();
+
+    SECTION("timeout is the earliest of the schedule, the deadlines, and the maximum wait")
+    {
+        c.deadline.deadline = 1000000;
+        runtime.tick();
+        CHECK(runtime.timeout(0) == 5000);
+        CHECK(runtime.timeout(4000) == 1000);
+        c.deadline.deadline = 2000;
+        CHECK(runtime.timeout(0) == 2000);
+        CHECK(runtime.timeout(2000) == 0);
+        static unscheduled_components_t u{};
+        u.deadline.deadline = 1000000;
+        auto unscheduled = TicklessRuntime<unscheduled_components_t, 100000, fake_clock>{u};
+        CHECK(unscheduled.timeout(0) == 100000);
+    }
+
+    SECTION("wait returns when a source is readable or the timeout elapses")
+    {
+        REQUIRE(pipe(c.reader.fds) == 0);
+        auto start = std::chrono::steady_clock::now();
+        CHECK(runtime.wait(2000) == 0);
+        CHECK(std::chrono::steady_clock::now() - start >= std::chrono::microseconds(2000));
+
+        REQUIRE(write(c.reader.fds[1], "x", 1) == 1);
+        start = std::chrono::steady_clock::now();
+        CHECK(runtime.wait(10000000) == 1);
+        CHECK(std::chrono::steady_clock::now() - start < std::chrono::seconds(1));
+        runtime.tick();
+        CHECK(c.reader.outputs.received.value == 1);
+
+        close(c.reader.fds[0]);
+        close(c.reader.fds[1]);
+        c.reader.fds[0] = 1000; // not an open descriptor
+        CHECK(runtime.wait(1000) == 0); // polling fails, but the runtime still sleeps
+        c.reader.fds[0] = -1;
+    }
+
+    SECTION("wait sleeps when a source has hung up")
+    {
+        REQUIRE(pipe(c.reader.fds) == 0);
+        close(c.reader.fds[1]); // the pipe reports POLLHUP from now on
+        auto start = std::chrono::steady_clock::now();
+        CHECK(runtime.wait(2000) == 0);
+        CHECK(std::chrono::steady_clock::now() - start >= std::chrono::microseconds(2000));
+        close(c.reader.fds[0]);
+        c.reader.fds[0] = -1;
+    }
+
+    SECTION("wait only sleeps for the rest of the timeout after a source hangs up")
+    {
+        REQUIRE(pipe(c.reader.fds) == 0);
+        close(c.reader.fds[1]);
+        auto stepping = TicklessRuntime<tickless_components_t, 100000, stepping_clock>{c};
+        auto start = std::chrono::steady_clock::now();
+        CHECK(stepping.wait(1000000) == 0); // a whole timeout passes between readings of the clock
+        CHECK(std::chrono::steady_clock::now() - start < std::chrono::milliseconds(500));
+        close(c.reader.fds[0]);
+        c.reader.fds[0] = -1;
+    }
+}
@@ -12,6 +12,7 @@ SPDX-License-Identifier: MIT
 #include "pico/stdlib.h"
 #include "hardware/gpio.h"
 #include "sygac-runtime.hpp"
+#include "sygsp-micros.hpp"
 #include "sygbr-cli.hpp"
 
 namespace sygaldry { namespace sygbr {
@@ -59,7 +60,7 @@ struct PicoSDKInstrument
         puts("looping\n");
         while (true)
         {
-            runtime.tick();
+            runtime.tick(sygsp::micros());
             //sleep_ms(1); // sometimes handy while testing
         }
     }
@@ -77,9 +77,9 @@ void TrillCraft::init()
     delay(trill->interCommandDelay);
 }
 
-void TrillCraft::main()
+sygsp::task TrillCraft::main()
 {
-    if (not outputs.running) return; // TODO: try to reconnect every so often
+    if (not outputs.running) return {}; // TODO: try to reconnect every so often
 
     auto trill = static_cast<Trill*>(pimpl);
 
@@ -112,37 +112,49 @@ void TrillCraft::main()
         outputs.any = 1;
     }
 
+    bool scan = inputs.speed.updated || inputs.resolution.updated;
+    bool noise = inputs.noise_threshold.updated;
+    bool prescale = inputs.prescaler.updated;
+    bool baseline = inputs.resolution.updated || inputs.prescaler.updated || inputs.update_baseline;
+    if (scan || noise || prescale || baseline) return configure(scan, noise, prescale, baseline);
+    return {};
+}
+
+sygsp::task TrillCraft::configure(bool scan, bool noise, bool prescale, bool baseline)
+{
+    // the update flags are cleared in the next tick, so they are passed in before suspending
+    auto trill = static_cast<Trill*>(pimpl);
+    const unsigned long inter_command_delay = trill->interCommandDelay * 1000ul;
+
     // TODO: find a better workaround for this
     // we introduce an obnoxious delay before changing settings to ensure the trill is done with any
     // reading-related operations that seem to prevent it from changing settings
-    if (inputs.speed.updated || inputs.resolution.updated)
+    if (scan)
     {
         // note that the Trill arduino library already boundary constrains scan settings
-        delay(2000);
+        co_await sygsp::sleep_for(2000000);
         trill->setScanSettings(inputs.speed, inputs.resolution);
-        delay(trill->interCommandDelay);
-        // TODO: these delays may not be acceptable in the main loop...
+        co_await sygsp::sleep_for(inter_command_delay);
     }
     // TODO: we should check and constrain boundary conditions
-    if (inputs.noise_threshold.updated)
+    if (noise)
     {
         trill->setNoiseThreshold(inputs.noise_threshold);
-        delay(trill->interCommandDelay);
+        co_await sygsp::sleep_for(inter_command_delay);
     }
     //if (inputs.autoscan_interval.updated)                trill->setAutoScanInterval(inputs.autoscan_interval);
-    if (inputs.prescaler.updated)
+    if (prescale)
     {
-        delay(2000);
+        co_await sygsp::sleep_for(2000000);
         trill->setPrescaler(inputs.prescaler);
-        delay(trill->interCommandDelay);
+        co_await sygsp::sleep_for(inter_command_delay);
     }
-    if (inputs.resolution.updated || inputs.prescaler.updated || inputs.update_baseline)
+    if (baseline)
     {
         for (auto& max : outputs.max_seen.value) max = 0;
         trill->updateBaseline();
-        delay(trill->interCommandDelay);
+        co_await sygsp::sleep_for(inter_command_delay);
     }
-
 }
 
 } }
@@ -16,6 +16,7 @@ SPDX-License-Identifier: MIT
 #include <cstdint>
 #include "sygah-metadata.hpp"
 #include "sygah-endpoints.hpp"
+#include "sygsp-task.hpp"
 
 namespace sygaldry { namespace sygsa {
 ///\addtogroup sygsa
@@ -122,8 +123,16 @@ struct TrillCraft
     */
     void init();
 
-    /// Update configuration parameters and attempt to read raw data, producing updated instant maximum, normalized, and discretized values
-    void main();
+    /*! \brief Attempt to read raw data, producing updated instant maximum, normalized, and discretized values, and update configuration parameters
+
+    \details The sensor needs some time to settle before and after its
+    settings are changed. When they are, the returned task waits without
+    blocking the rest of the loop, and no data is read until it is done.
+    */
+    sygsp::task main();
+
+    /// Send the updated settings to the sensor, waiting for it between commands
+    sygsp::task configure(bool scan, bool noise, bool prescale, bool baseline);
 };
 
 ///\}
@@ -55,6 +55,10 @@ Based on measurements of the magnetic field, acceleration, and
 angular rate from a MIMU sensor, estimate the orientation of the
 sensor with respect to the global frame of reference, and various
 other signals of interest.
+
+The filter only does any work when the MIMU has a new gyroscope measurement,
+so it is declared change driven, allowing the runtime to skip it in ticks
+where none of the MIMU's output flags are set.
 */
 template<MimuComponent Mimu>
 struct ComplementaryMimuFusion
@@ -64,6 +68,7 @@ struct ComplementaryMimuFusion
 , copyright_<"Copyright 2023 Sygaldry Contributors">
 , license_<"SPDX-License-Identifier: MIT">
 , version_<"0.0.0">
+, change_driven_
 {
     ComplementaryMimuFusionInputs inputs;
 
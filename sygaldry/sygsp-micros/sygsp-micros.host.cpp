@@ -0,0 +1,21 @@
+/*
+Copyright 2026 Travis J. West, https://traviswest.ca, Input Devices and Music
+Interaction Laboratory (IDMIL), Centre for Interdisciplinary Research in Music
+Media and Technology (CIRMMT), McGill University, Montréal, Canada, and Univ.
+Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
+
+SPDX-License-Identifier: MIT
+*/
+#include <chrono>
+#include "sygsp-micros.hpp"
+
+namespace sygaldry { namespace sygsp {
+
+unsigned long micros()
+{
+    using namespace std::chrono;
+    static const auto epoch = steady_clock::now();
+    return static_cast<unsigned long>(duration_cast<microseconds>(steady_clock::now() - epoch).count());
+}
+
+} }
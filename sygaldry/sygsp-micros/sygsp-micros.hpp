@@ -36,7 +36,8 @@ need to link the platform-specific library as well as including the header
 in which this function is declared.
 
 This API is currently implemented for ESP-IDF and Raspberry Pi Pico SDK via
-the [Arduino hack subsystem](\ref page-sygsa-micros).
+the [Arduino hack subsystem](\ref page-sygsa-micros), and for hosted
+platforms using the standard library's steady clock.
 */
 unsigned long micros();
 
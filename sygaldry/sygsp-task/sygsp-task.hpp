@@ -0,0 +1,106 @@
+#pragma once
+/*
+Copyright 2026 Travis J. West, https://traviswest.ca, Input Devices and Music
+Interaction Laboratory (IDMIL), Centre for Interdisciplinary Research in Music
+Media and Technology (CIRMMT), McGill University, Montréal, Canada, and Univ.
+Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
+
+SPDX-License-Identifier: MIT
+*/
+
+#include <coroutine>
+#include <exception>
+#include <utility>
+#include "sygsp-micros.hpp"
+
+namespace sygaldry { namespace sygsp {
+
+/// \addtogroup sygsp
+/// \{
+
+/// \defgroup sygsp-task sygsp-task: Coroutine Tasks
+/// Literate source code: page-sygsp-task
+/// \{
+
+/// A coroutine that can suspend until a condition is met, and is resumed by calling `resume` until it is `done`
+struct task
+{
+    struct promise_type
+    {
+        /// The condition to meet before resuming, or `nullptr` to resume unconditionally
+        bool (*ready)(void*) = nullptr;
+        /// The awaiter on which the coroutine is suspended, passed to `ready`
+        void * awaiter = nullptr;
+
+        task get_return_object() { return task{std::coroutine_handle<promise_type>::from_promise(*this)}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+
+    using handle_t = std::coroutine_handle<promise_type>;
+
+    handle_t handle = nullptr;
+
+    constexpr task() = default;
+    explicit task(handle_t h) : handle{h} {}
+    task(task&& other) noexcept : handle{std::exchange(other.handle, nullptr)} {}
+    task& operator=(task&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (handle) handle.destroy();
+            handle = std::exchange(other.handle, nullptr);
+        }
+        return *this;
+    }
+    task(const task&) = delete;
+    task& operator=(const task&) = delete;
+    constexpr ~task() { if (handle) handle.destroy(); }
+
+    /// Check whether the coroutine has finished, or there is none
+    bool done() const { return not handle || handle.done(); }
+
+    /// Resume the coroutine if it hasn't finished and the condition it is waiting for is met
+    void resume()
+    {
+        if (done()) return;
+        auto& p = handle.promise();
+        if (p.ready && not p.ready(p.awaiter)) return;
+        p.ready = nullptr;
+        handle.resume();
+    }
+};
+
+/// Suspend a task until `condition()` returns true
+template<typename Condition>
+struct until
+{
+    Condition condition;
+
+    bool await_ready() { return condition(); }
+    void await_suspend(task::handle_t h)
+    {
+        h.promise().ready = [](void * self) { return static_cast<until*>(self)->condition(); };
+        h.promise().awaiter = this;
+    }
+    void await_resume() {}
+};
+
+template<typename Condition> until(Condition) -> until<Condition>;
+
+/// Suspend a task until at least `us` microseconds have elapsed
+template<unsigned long (*clock)() = micros>
+auto sleep_for(unsigned long us)
+{
+    return until{[start = clock(), us]() { return clock() - start >= us; }};
+}
+
+/// Suspend a task until it is next resumed, i.e. until the next tick in which its component runs
+inline std::suspend_always next_tick() { return {}; }
+
+/// \}
+/// \}
+
+} }
@@ -0,0 +1,129 @@
+/*
+Copyright 2026 Travis J. West, https://traviswest.ca, Input Devices and Music
+Interaction Laboratory (IDMIL), Centre for Interdisciplinary Research in Music
+Media and Technology (CIRMMT), McGill University, Montréal, Canada, and Univ.
+Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
+
+SPDX-License-Identifier: MIT
+*/
+
+#include <catch2/catch_test_macros.hpp>
+#include "sygah-metadata.hpp"
+#include "sygac-runtime.hpp"
+#include "sygsp-task.hpp"
+
+using namespace sygaldry;
+using namespace sygaldry::sygsp;
+
+unsigned long fake_time = 0;
+unsigned long fake_clock() { return fake_time; }
+
+struct sleeper_t : name_<"sleeper">
+{
+    struct outputs_t {
+        struct steps_t {
+            int value;
+        } steps;
+    } outputs;
+
+    task sleep()
+    {
+        ++outputs.steps.value;
+        co_await sleep_for<fake_clock>(1000);
+        ++outputs.steps.value;
+        co_await next_tick();
+        ++outputs.steps.value;
+    }
+
+    task main()
+    {
+        if (outputs.steps.value == 0) return sleep();
+        return task{};
+    }
+};
+
+struct counter_t : name_<"counter">
+{
+    struct outputs_t {
+        struct count_t {
+            int value;
+        } count;
+    } outputs;
+
+    void main() { ++outputs.count.value; }
+};
+
+struct sleepers_t
+{
+    sleeper_t sleeper;
+    counter_t counter;
+};
+
+TEST_CASE("sygaldry task", "[sygsp][task]")
+{
+    static_assert(Resumable<task>);
+    CHECK(task{}.done());
+
+    static sleepers_t c{};
+    constexpr auto runtime = Runtime{c};
+    runtime.init();
+    runtime.tick();
+    CHECK(c.sleeper.outputs.steps.value == 1);
+    fake_time = 999;
+    runtime.tick();
+    CHECK(c.sleeper.outputs.steps.value == 1); // still sleeping
+    fake_time = 1000;
+    runtime.tick();
+    CHECK(c.sleeper.outputs.steps.value == 2);
+    runtime.tick();
+    CHECK(c.sleeper.outputs.steps.value == 3);
+    runtime.tick();
+    CHECK(c.sleeper.outputs.steps.value == 3); // main returns a finished task
+    CHECK(c.counter.outputs.count.value == 5); // other components keep running
+
+    int flag = 0;
+    auto waiter = [&]() -> task { co_await until{[&](){ return flag > 0; }}; flag = 2; }();
+    CHECK(not waiter.done());
+    waiter.resume();
+    CHECK(not waiter.done());
+    flag = 1;
+    waiter.resume();
+    CHECK(waiter.done());
+    CHECK(flag == 2);
+}
+
+int guards_destroyed = 0;
+
+struct guarded_t : name_<"guarded">
+{
+    struct outputs_t {
+        struct starts_t {
+            int value;
+        } starts;
+    } outputs;
+
+    task main()
+    {
+        struct guard_t { ~guard_t() { ++guards_destroyed; } } guard;
+        ++outputs.starts.value;
+        co_await next_tick();
+    }
+};
+
+struct guarded_components_t
+{
+    guarded_t guarded;
+};
+
+TEST_CASE("sygaldry task destroyed with its runtime", "[sygsp][task]")
+{
+    guarded_components_t c{};
+    {
+        auto runtime = Runtime{c};
+        runtime.init();
+        runtime.tick();
+        CHECK(c.guarded.outputs.starts.value == 1);
+        CHECK(guards_destroyed == 0); // suspended
+    }
+    CHECK(guards_destroyed == 1); // the suspended frame is destroyed with the runtime
+}
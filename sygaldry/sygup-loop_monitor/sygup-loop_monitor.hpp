@@ -0,0 +1,120 @@
+#pragma once
+/*
+Copyright 2026 Travis J. West, https://traviswest.ca, Input Devices and Music
+Interaction Laboratory (IDMIL), Centre for Interdisciplinary Research in Music
+Media and Technology (CIRMMT), McGill University, Montréal, Canada, and Univ.
+Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
+
+SPDX-License-Identifier: MIT
+*/
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include "sygah-metadata.hpp"
+#include "sygah-endpoints.hpp"
+#include "sygac-runtime.hpp"
+#include "sygsp-micros.hpp"
+
+namespace sygaldry { namespace sygup {
+/// \addtogroup sygup
+/// \{
+/// \defgroup sygup-loop_monitor sygup-loop_monitor: Loop Monitor
+/// \{
+
+/*! \brief Timing statistics for the ticks of the runtime's loop, compared against a target period
+
+\tparam target_period The period with which the loop is expected to run, in the unit of the clock
+\tparam clock A function returning a timestamp; the measurements are reported in the same unit
+*/
+template<unsigned long target_period = 10000, unsigned long (*clock)() = sygsp::micros>
+struct LoopMonitor
+: name_<"Loop Monitor">
+, description_<"measures the period, jitter, and duration of the runtime's ticks">
+, author_<"Travis J. West">
+, copyright_<"Copyright 2026 Sygaldry Contributors">
+, license_<"SPDX-License-Identifier: MIT">
+, version_<"0.0.0">
+{
+    template<string_literal name, string_literal desc>
+    using timing = slider<name, desc, float, 0.0f, 1000000.0f>;
+
+    static constexpr std::size_t buckets = 16;
+
+    /// The histogram bucket of a jitter; bucket `i > 0` holds jitters in `[2^(i-1), 2^i)`
+    static constexpr std::size_t bucket_of(unsigned long jitter)
+    {
+        return std::min<std::size_t>(std::bit_width(jitter), buckets - 1);
+    }
+
+    void record_jitter(unsigned long period)
+    {
+        auto jitter = period > target_period ? period - target_period : target_period - period;
+        auto& bucket = outputs.jitter[bucket_of(jitter)];
+        if (bucket == std::numeric_limits<int>::max())
+            for (auto& b : outputs.jitter.value) b /= 2;
+        ++bucket;
+    }
+
+    struct inputs_t {
+        bng<"reset", "clear the accumulated measurements"> reset;
+    } inputs;
+
+    struct outputs_t {
+        timing<"target period", "the period with which the loop is expected to run"> target;
+        timing<"period", "time elapsed between the beginning of the last tick and the one before it"> period;
+        timing<"mean period", "mean time elapsed between the beginning of consecutive ticks"> mean_period;
+        timing<"duration", "time taken by the last tick"> duration;
+        timing<"worst duration", "longest time taken by any tick"> worst_duration;
+        slider<"overruns", "number of ticks that took longer than the target period", int, 0, 1000000> overruns;
+        array<"jitter", buckets, "histogram of the difference between the period and the target period, with one bucket per power of two", int, 0, 1000000> jitter;
+    } outputs;
+
+    unsigned long start = 0;
+    unsigned long periods = 0;
+    unsigned long long total = 0;
+    bool started = false;
+
+    void tick_started()
+    {
+        auto now = clock();
+        if (started)
+        {
+            auto period = now - start;
+            ++periods;
+            total += period;
+            outputs.period = period;
+            outputs.mean_period = static_cast<float>(total) / periods;
+            record_jitter(period);
+        }
+        started = true;
+        start = now;
+    }
+
+    void tick_finished()
+    {
+        auto duration = clock() - start;
+        outputs.duration = duration;
+        if (duration > outputs.worst_duration) outputs.worst_duration = duration;
+        if (duration > target_period) ++outputs.overruns.value;
+    }
+
+    void init() { outputs.target = target_period; }
+
+    void main()
+    {
+        if (not inputs.reset) return;
+        periods = 0;
+        total = 0;
+        outputs.period = 0;
+        outputs.mean_period = 0;
+        outputs.duration = 0;
+        outputs.worst_duration = 0;
+        outputs.overruns = 0;
+        outputs.jitter.value = {};
+    }
+};
+
+/// \}
+/// \}
+} }
@@ -0,0 +1,73 @@
+/*
+Copyright 2026 Travis J. West, https://traviswest.ca, Input Devices and Music
+Interaction Laboratory (IDMIL), Centre for Interdisciplinary Research in Music
+Media and Technology (CIRMMT), McGill University, Montréal, Canada, and Univ.
+Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
+
+SPDX-License-Identifier: MIT
+*/
+
+#include <catch2/catch_test_macros.hpp>
+#include "sygup-loop_monitor.hpp"
+
+using namespace sygaldry;
+using namespace sygaldry::sygup;
+
+unsigned long fake_time = 0;
+unsigned long fake_clock() { return fake_time; }
+
+struct busy_t : name_<"busy">
+{
+    struct outputs_t {
+        struct count_t {
+            int value;
+        } count;
+    } outputs;
+
+    void main() { fake_time += 100 * ++outputs.count.value; }
+};
+
+struct monitored_t
+{
+    busy_t busy;
+    LoopMonitor<1000, fake_clock> monitor;
+};
+
+TEST_CASE("sygaldry Loop Monitor", "[components][loop_monitor]")
+{
+    static_assert(TickMonitor<LoopMonitor<1000, fake_clock>>);
+    static monitored_t monitored{};
+    constexpr auto runtime = Runtime{monitored};
+    auto& outputs = monitored.monitor.outputs;
+    runtime.init();
+    CHECK(outputs.target == 1000);
+
+    // tick durations of 100, 200, ... 1200, sleeping until the next deadline when there is time left
+    unsigned long deadline = 0;
+    for (int i = 0; i < 12; ++i)
+    {
+        if (fake_time < deadline) fake_time = deadline;
+        deadline += 1000;
+        runtime.tick();
+    }
+    CHECK(outputs.duration == 1200);
+    CHECK(outputs.worst_duration == 1200);
+    CHECK(outputs.overruns == 2); // 1100 and 1200
+    CHECK(outputs.period == 1100); // the tick before the last one overran
+    CHECK(outputs.mean_period == 11100.0f / 11);
+    CHECK(outputs.jitter[0] == 10);
+    CHECK(outputs.jitter[LoopMonitor<1000, fake_clock>::bucket_of(100)] == 1);
+
+    // set the reset input as a binding would, after input flags are cleared
+    runtime.tick_started();
+    runtime.advance();
+    runtime.external_sources();
+    monitored.monitor.inputs.reset();
+    runtime.main();
+    runtime.external_destinations();
+    runtime.tick_finished();
+    CHECK(outputs.overruns == 1); // the reset tick itself overran
+    CHECK(outputs.jitter[0] == 0);
+    CHECK(outputs.period == 0);
+    CHECK(outputs.worst_duration == 1300);
+}
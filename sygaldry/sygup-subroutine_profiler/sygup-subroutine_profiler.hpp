@@ -0,0 +1,150 @@
+#pragma once
+/*
+Copyright 2026 Travis J. West, https://traviswest.ca, Input Devices and Music
+Interaction Laboratory (IDMIL), Centre for Interdisciplinary Research in Music
+Media and Technology (CIRMMT), McGill University, Montréal, Canada, and Univ.
+Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
+
+SPDX-License-Identifier: MIT
+*/
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include "sygah-metadata.hpp"
+#include "sygah-endpoints.hpp"
+#include "sygac-runtime.hpp"
+#include "sygsp-micros.hpp"
+
+namespace sygaldry { namespace sygup {
+/// \addtogroup sygup
+/// \{
+/// \defgroup sygup-subroutine_profiler sygup-subroutine_profiler: Subroutine Profiler
+/// \{
+
+/*! \brief Timing statistics for the subroutines of every component, recorded by the runtime
+
+\tparam capacity The number of components for which statistics are kept
+\tparam p The percentile to estimate, e.g. 99
+\tparam clock A function returning a timestamp; the durations are reported in the same unit
+*/
+template<std::size_t capacity = 32, unsigned int p = 99, unsigned long (*clock)() = sygsp::micros>
+struct SubroutineProfiler
+: name_<"Subroutine Profiler">
+, description_<"times the subroutines of every component run by the runtime">
+, author_<"Travis J. West">
+, copyright_<"Copyright 2026 Sygaldry Contributors">
+, license_<"SPDX-License-Identifier: MIT">
+, version_<"0.0.0">
+{
+    template<string_literal name, string_literal desc>
+    using timing = array<name, capacity, desc, float, 0.0f, 1000000.0f>;
+
+    struct inputs_t {
+        bng<"reset", "clear the accumulated statistics"> reset;
+    } inputs;
+
+    struct outputs_t {
+        timing<"init", "duration of each component's init subroutine"> init;
+        timing<"external sources min", "minimum duration of each component's external sources subroutine"> external_sources_min;
+        timing<"external sources mean", "mean duration of each component's external sources subroutine"> external_sources_mean;
+        timing<"external sources max", "maximum duration of each component's external sources subroutine"> external_sources_max;
+        timing<"external sources percentile", "estimated percentile duration of each component's external sources subroutine"> external_sources_percentile;
+        timing<"main min", "minimum duration of each component's main subroutine"> main_min;
+        timing<"main mean", "mean duration of each component's main subroutine"> main_mean;
+        timing<"main max", "maximum duration of each component's main subroutine"> main_max;
+        timing<"main percentile", "estimated percentile duration of each component's main subroutine"> main_percentile;
+        timing<"external destinations min", "minimum duration of each component's external destinations subroutine"> external_destinations_min;
+        timing<"external destinations mean", "mean duration of each component's external destinations subroutine"> external_destinations_mean;
+        timing<"external destinations max", "maximum duration of each component's external destinations subroutine"> external_destinations_max;
+        timing<"external destinations percentile", "estimated percentile duration of each component's external destinations subroutine"> external_destinations_percentile;
+    } outputs;
+
+    /// Timing statistics accumulated for one subroutine of one component
+    struct stats_t
+    {
+        static constexpr std::size_t buckets = 16;
+
+        unsigned long count = 0;
+        unsigned long min = 0;
+        unsigned long max = 0;
+        unsigned long long total = 0;
+        std::array<std::uint16_t, buckets> histogram{};
+
+        /// The histogram bucket of a duration; bucket `i > 0` holds durations in `[2^(i-1), 2^i)`
+        static constexpr std::size_t bucket_of(unsigned long elapsed)
+        {
+            return std::min<std::size_t>(std::bit_width(elapsed), buckets - 1);
+        }
+
+        void record(unsigned long elapsed)
+        {
+            if (count == 0 || elapsed < min) min = elapsed;
+            if (elapsed > max) max = elapsed;
+            ++count;
+            total += elapsed;
+            auto& bucket = histogram[bucket_of(elapsed)];
+            if (bucket == std::numeric_limits<std::uint16_t>::max())
+                for (auto& b : histogram) b /= 2;
+            ++bucket;
+        }
+
+        float mean() const { return count ? static_cast<float>(total) / count : 0.0f; }
+
+        /// Estimate the duration below which `percent` percent of the recorded durations fall
+        unsigned long percentile(unsigned int percent) const
+        {
+            unsigned long n = 0;
+            for (auto b : histogram) n += b;
+            if (n == 0) return 0;
+            unsigned long threshold = (n * percent + 99) / 100;
+            unsigned long seen = 0;
+            for (std::size_t i = 0; i < buckets - 1; ++i)
+            {
+                seen += histogram[i];
+                if (seen >= threshold) return std::min(max, (1ul << i) - 1);
+            }
+            return max;
+        }
+    };
+
+    /// The statistics for the external sources, main, and external destinations subroutines of each component
+    std::array<std::array<stats_t, capacity>, 3> stats{};
+
+    unsigned long timestamp() { return clock(); }
+
+    void record(std::size_t index, runtime_subroutine subroutine, unsigned long elapsed)
+    {
+        if (index >= capacity) return;
+        if (subroutine == runtime_subroutine::init) outputs.init[index] = elapsed;
+        else stats[static_cast<std::size_t>(subroutine) - 1][index].record(elapsed);
+    }
+
+    static void publish(const std::array<stats_t, capacity>& s, auto& min, auto& mean, auto& max, auto& percentile)
+    {
+        for (std::size_t i = 0; i < capacity; ++i)
+        {
+            min[i] = s[i].min;
+            mean[i] = s[i].mean();
+            max[i] = s[i].max;
+            percentile[i] = s[i].percentile(p);
+        }
+    }
+
+    void main()
+    {
+        if (inputs.reset) stats = {};
+        publish(stats[0], outputs.external_sources_min, outputs.external_sources_mean
+               , outputs.external_sources_max, outputs.external_sources_percentile);
+        publish(stats[1], outputs.main_min, outputs.main_mean
+               , outputs.main_max, outputs.main_percentile);
+        publish(stats[2], outputs.external_destinations_min, outputs.external_destinations_mean
+               , outputs.external_destinations_max, outputs.external_destinations_percentile);
+    }
+};
+
+/// \}
+/// \}
+} }
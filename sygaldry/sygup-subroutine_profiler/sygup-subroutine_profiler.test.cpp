@@ -0,0 +1,63 @@
+/*
+Copyright 2026 Travis J. West, https://traviswest.ca, Input Devices and Music
+Interaction Laboratory (IDMIL), Centre for Interdisciplinary Research in Music
+Media and Technology (CIRMMT), McGill University, Montréal, Canada, and Univ.
+Lille, Inria, CNRS, Centrale Lille, UMR 9189 CRIStAL, F-59000 Lille, France
+
+SPDX-License-Identifier: MIT
+*/
+
+#include <catch2/catch_test_macros.hpp>
+#include "sygup-subroutine_profiler.hpp"
+
+using namespace sygaldry;
+using namespace sygaldry::sygup;
+
+unsigned long fake_time = 0;
+unsigned long fake_clock() { return fake_time; }
+
+struct busy_t : name_<"busy">
+{
+    struct outputs_t {
+        struct count_t {
+            int value;
+        } count;
+    } outputs;
+
+    void main() { fake_time += ++outputs.count.value; }
+};
+
+struct profiled_t
+{
+    busy_t busy;
+    SubroutineProfiler<4, 99, fake_clock> profiler;
+};
+
+TEST_CASE("sygaldry Subroutine Profiler", "[components][subroutine_profiler]")
+{
+    static_assert(RuntimeProfiler<SubroutineProfiler<4, 99, fake_clock>>);
+    static profiled_t profiled{};
+    constexpr auto runtime = Runtime{profiled};
+    runtime.init();
+    for (int i = 0; i < 100; ++i) runtime.tick();
+    auto& outputs = profiled.profiler.outputs;
+    CHECK(outputs.main_min[0] == 1);
+    CHECK(outputs.main_max[0] == 100);
+    CHECK(outputs.main_mean[0] == 50.5f);
+    CHECK(outputs.main_percentile[0] == 100); // clipped to the maximum
+    CHECK(profiled.profiler.stats[1][0].percentile(50) == 63); // the upper bound of [32, 64)
+    CHECK(outputs.main_max[1] == 0); // the profiler itself doesn't advance the fake clock
+    CHECK(outputs.external_sources_max[0] == 0);
+
+    // set the reset input as a binding would, after input flags are cleared
+    runtime.advance();
+    runtime.external_sources();
+    profiled.profiler.inputs.reset();
+    runtime.main();
+    runtime.external_destinations();
+    CHECK(outputs.main_min[0] == 0);
+    CHECK(outputs.main_max[0] == 0);
+    runtime.tick();
+    CHECK(outputs.main_min[0] == 102);
+    CHECK(outputs.main_max[0] == 102);
+}